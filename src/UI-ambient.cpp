@@ -0,0 +1,86 @@
+// ============================================
+// TTGO Watch Ambient Display Implementation
+// Version: 2.4 - Always-on Ambient Mode
+// ============================================
+
+#include "UI-ambient.h"
+
+// ST7789 명령
+#define ST_CMD_PTLON    0x12    // partial 모드 켜기
+#define ST_CMD_NORON    0x13    // normal 모드 (partial 끄기)
+#define ST_CMD_PTLAR    0x30    // partial 영역 (시작/끝 게이트 라인)
+#define ST_CMD_IDMOFF   0x38    // idle 모드 끄기
+#define ST_CMD_IDMON    0x39    // idle 모드 켜기 (채널당 1비트 = 8색)
+
+AmbientDisplay::AmbientDisplay() {
+    tft = nullptr;
+    rotation = 0;
+    active = false;
+    partial = false;
+    entries = 0;
+    lastDurationSec = 0;
+    enteredAt = 0;
+}
+
+void AmbientDisplay::begin(TFT_eSPI *panel, uint8_t rot) {
+    tft = panel;
+    rotation = rot;
+}
+
+// 240x240 패널은 320줄 GRAM의 0~239줄을 스캔
+//   회전 2(MX|MY)는 행 주소가 뒤집혀 논리 y가 239 - y 줄에 표시됨
+bool AmbientDisplay::gateLines(int16_t y0, int16_t y1, uint16_t &start, uint16_t &end) const {
+    y0 = max(y0, (int16_t)0);
+    y1 = min(y1, (int16_t)SCREEN_HEIGHT);
+    if (y1 <= y0) return false;
+
+    switch (rotation) {
+        case 0:
+            start = y0;
+            end = y1 - 1;
+            return true;
+        case 2:
+            start = SCREEN_HEIGHT - y1;
+            end = SCREEN_HEIGHT - 1 - y0;
+            return true;
+        default:
+            return false;
+    }
+}
+
+// ============================================
+// Enter / Exit
+// ============================================
+void AmbientDisplay::enter(int16_t y0, int16_t y1) {
+    if (tft == nullptr || active) return;
+
+    uint16_t start, end;
+    partial = gateLines(y0, y1, start, end);
+    if (partial) {
+        tft->writecommand(ST_CMD_PTLAR);
+        tft->writedata(start >> 8);
+        tft->writedata(start & 0xFF);
+        tft->writedata(end >> 8);
+        tft->writedata(end & 0xFF);
+        tft->writecommand(ST_CMD_PTLON);
+    }
+    tft->writecommand(ST_CMD_IDMON);
+
+    active = true;
+    entries++;
+    enteredAt = millis();
+    _PF("Ambient: on (idle 8-color%s, rows %d..%d)\n", partial ? " + partial" : "", y0, y1 - 1);
+}
+
+void AmbientDisplay::exit() {
+    if (tft == nullptr || !active) return;
+
+    tft->writecommand(ST_CMD_IDMOFF);
+    if (partial) {
+        tft->writecommand(ST_CMD_NORON);
+    }
+
+    active = false;
+    lastDurationSec = (millis() - enteredAt) / 1000;
+    _PF("Ambient: off after %lu s\n", (unsigned long)lastDurationSec);
+}
@@ -0,0 +1,64 @@
+// ============================================
+// TTGO Watch Analog Face
+// Version: 2.4 - Analog Gauge Face
+// ============================================
+#ifndef UI_ANALOG_H
+#define UI_ANALOG_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "UI-dirty.h"
+#include "UI-stamp.h"
+
+#define ANALOG_HANDS        3       // 시, 분, 초 (그리는 순서 = z 순서)
+#define ANALOG_BOX_MARGIN   2       // 회전 경계 사각형 여유 (반올림 오차)
+
+// ============================================
+// AnalogFace
+//   - 눈금판은 처음 한 번 프레임에 그린 뒤 PSRAM 배경으로 보관
+//   - 바늘은 시작 시 작은 스프라이트에 한 번 그려 두고 pushRotated로 합성
+//   - 움직인 바늘의 이전/새 경계 사각형만 배경에서 복원하고,
+//     그 영역에 걸친 바늘만 z 순서대로 다시 그림
+//   - 16bpp 전체 프레임 (PSRAM 합성기 모드) 전용
+// ============================================
+class AnalogFace {
+public:
+    AnalogFace();
+    ~AnalogFace();
+
+    bool begin(TFT_eSPI *panel);
+    bool isReady() const { return background != nullptr; }
+
+    // frame: 16bpp 전체 프레임 스프라이트, repaint: 화면 전체를 새로 그림
+    // secondMs: 현재 초 안의 경과 ms (ANALOG_SWEEP일 때만 사용)
+    void draw(TFT_eSprite *frame, DirtyRegion *damage,
+              int hour, int minute, int second, uint16_t secondMs, bool repaint);
+
+    // 통계 (마지막 draw)
+    uint32_t getLastRestoredPixels() const { return lastRestored; }
+    uint8_t getLastHandsDrawn() const { return lastHands; }
+
+private:
+    struct Hand {
+        TFT_eSprite *sprite;
+        int16_t pivotX;
+        int16_t pivotY;
+        int16_t angle;
+        DirtyRect box;
+        bool drawn;
+    };
+
+    Hand hands[ANALOG_HANDS];
+    uint16_t *background;
+    bool dialCaptured;
+
+    uint32_t lastRestored;
+    uint8_t lastHands;
+
+    bool buildHand(Hand &h, TFT_eSPI *panel, int16_t width, int16_t length, int16_t tail, uint16_t color);
+    void renderDial(TFT_eSprite *frame);
+    DirtyRect boundsFor(const Hand &h, int16_t angle) const;
+    void restore(uint16_t *fb, const DirtyRect &r);
+};
+
+#endif // UI_ANALOG_H
@@ -0,0 +1,61 @@
+// ============================================
+// TTGO Watch Animation Clock
+// Version: 2.4 - Time-based Animation
+// ============================================
+#ifndef UI_ANIM_H
+#define UI_ANIM_H
+
+#include <Arduino.h>
+#include <esp_timer.h>
+#include "config.h"
+
+// ============================================
+// AnimationClock
+//   - 단조 증가 µs 타이머 (esp_timer)
+//   - 프레임 시작 시 tick() 한 번 → 그 프레임의 모든 애니메이션이 같은 시각 사용
+// ============================================
+class AnimationClock {
+public:
+    AnimationClock();
+
+    static int64_t micros64() { return esp_timer_get_time(); }
+
+    void tick();
+
+    int64_t now() const { return frameUs; }
+    int64_t delta() const { return deltaUs; }
+    uint32_t getFrameCount() const { return frames; }
+
+private:
+    int64_t frameUs;
+    int64_t deltaUs;
+    uint32_t frames;
+};
+
+// ============================================
+// AngleAnimation
+//   - 고정 각속도 회전: 각도 = 시작 각도 + 속도 x 경과 시간
+//   - 프레임이 늦으면 그만큼 건너뛰고, 빠르면 같은 각도 유지
+//   - 속도를 바꿔도 현재 각도에서 이어짐
+// ============================================
+class AngleAnimation {
+public:
+    AngleAnimation();
+
+    // degPerSec < 0 이면 반시계 방향
+    void begin(const AnimationClock *clock, float startDeg, float degPerSec);
+    void setSpeed(float degPerSec);
+    float getSpeed() const { return speed; }
+
+    // 현재 프레임 각도 (0..359, 정수 좌표 테이블 인덱스)
+    int angle() const;
+    float angleExact() const;
+
+private:
+    const AnimationClock *clock;
+    int64_t startUs;
+    float startDeg;
+    float speed;
+};
+
+#endif // UI_ANIM_H
@@ -0,0 +1,118 @@
+// ============================================
+// TTGO Watch Static Background Image Implementation
+// Version: 2.4 - RLE Clock Background
+// ============================================
+
+#include "UI-background.h"
+
+// 생성용 띠 높이 (240 x 24 x 2 = 11.5KB, 생성 후 해제)
+#define BG_STRIP_ROWS   24
+
+BackgroundImage::BackgroundImage() {
+    runs = nullptr;
+    runCount = 0;
+    builtTag = 0;
+    lastBuildUs = 0;
+}
+
+BackgroundImage::~BackgroundImage() {
+    end();
+}
+
+// ============================================
+// Build - 띠마다 그린 뒤 RLE (개수 세기 → 할당 → 부호화)
+// ============================================
+bool BackgroundImage::build(TFT_eSPI *panel, const PaintFn &paint, uint16_t bg, uint32_t tag) {
+    end();
+    unsigned long t0 = micros();
+
+    TFT_eSprite strip(panel);
+    strip.setColorDepth(16);
+    if (strip.createSprite(SCREEN_WIDTH, BG_STRIP_ROWS) == nullptr) {
+        _PL("Background: no RAM for build strip");
+        return false;
+    }
+
+    uint32_t count = renderPass(&strip, paint, bg, nullptr);
+    if (count > BACKGROUND_MAX_RUNS) {
+        _PF("Background: %lu runs > %d - glyph fallback\n", (unsigned long)count, BACKGROUND_MAX_RUNS);
+        strip.deleteSprite();
+        return false;
+    }
+
+    size_t bytes = count * 2 * sizeof(uint16_t);
+    uint16_t *buf = psramFound() ? (uint16_t *)ps_malloc(bytes) : (uint16_t *)malloc(bytes);
+    if (buf == nullptr) {
+        _PL("Background: allocation failed - glyph fallback");
+        strip.deleteSprite();
+        return false;
+    }
+
+    renderPass(&strip, paint, bg, buf);
+    strip.deleteSprite();
+
+    runs = buf;
+    runCount = count;
+    builtTag = tag;
+    lastBuildUs = micros() - t0;
+    _PF("Background: %lu runs (%lu bytes) built in %lu us\n",
+        (unsigned long)runCount, (unsigned long)getBytes(), (unsigned long)lastBuildUs);
+    return true;
+}
+
+void BackgroundImage::end() {
+    if (runs != nullptr) {
+        free(runs);
+        runs = nullptr;
+    }
+    runCount = 0;
+}
+
+void BackgroundImage::draw(UICanvas *tft) const {
+    if (!isReady()) return;
+    tft->pushRuns(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, runs);
+}
+
+// ============================================
+// Internals
+// ============================================
+uint32_t BackgroundImage::renderPass(TFT_eSprite *strip, const PaintFn &paint, uint16_t bg, uint16_t *out) {
+    uint32_t total = 0;
+
+    for (int16_t y0 = 0; y0 < SCREEN_HEIGHT; y0 += BG_STRIP_ROWS) {
+        int16_t rows = min((int16_t)(SCREEN_HEIGHT - y0), (int16_t)BG_STRIP_ROWS);
+
+        // 합성기 밴드와 같은 방식: 뷰포트를 올려서 화면 좌표 그대로 그림
+        strip->fillSprite(bg);
+        strip->setViewport(0, -y0, SCREEN_WIDTH, SCREEN_HEIGHT, true);
+        UICanvas band(strip);
+        paint(&band);
+        strip->resetViewport();
+
+        total += encodeRows((const uint16_t *)strip->getPointer(), rows,
+                            out != nullptr ? out + total * 2 : nullptr);
+    }
+    return total;
+}
+
+uint32_t BackgroundImage::encodeRows(const uint16_t *pixels, int16_t rows, uint16_t *out) {
+    uint32_t n = 0;
+
+    for (int16_t j = 0; j < rows; j++) {
+        const uint16_t *row = pixels + j * SCREEN_WIDTH;
+        int16_t i = 0;
+        while (i < SCREEN_WIDTH) {
+            uint16_t c = row[i];
+            int16_t len = 1;
+            while (i + len < SCREEN_WIDTH && row[i + len] == c) len++;
+
+            if (out != nullptr) {
+                out[n * 2] = len;
+                out[n * 2 + 1] = c;
+            }
+            n++;
+            i += len;
+        }
+    }
+    return n;
+}
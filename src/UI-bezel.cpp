@@ -0,0 +1,165 @@
+// ============================================
+// TTGO Watch Rotating Bezel Cache Implementation
+// Version: 2.4 - Pre-rasterized Bezel
+// ============================================
+
+#include "UI-bezel.h"
+
+#define BEZEL_FONT      2
+
+// ============================================
+// Constructor / Destructor
+// ============================================
+BezelRing::BezelRing() {
+    labelText = nullptr;
+    fgColor = TFT_WHITE;
+    bgColor = TFT_BLACK;
+    tiles = nullptr;
+    tileH = 0;
+    cacheBytes = 0;
+
+    for (int i = 0; i < BEZEL_LABELS; i++) {
+        tileOffset[i] = 0;
+        tileW[i] = 0;
+        labelStartIdx[i] = 0;
+    }
+    for (int i = 0; i < BEZEL_DOTS; i++) {
+        dotStartIdx[i] = 0;
+    }
+}
+
+BezelRing::~BezelRing() {
+    release();
+}
+
+// ============================================
+// Build - 좌표 테이블 + 라벨 타일
+// ============================================
+bool BezelRing::build(TFT_eSPI *gfx, const String *labels,
+                      const int *labelStart, const int *dotStart,
+                      const float *labelX, const float *labelY,
+                      const float *outerX, const float *outerY,
+                      const float *innerX, const float *innerY,
+                      uint16_t fg, uint16_t bg) {
+    release();
+
+    labelText = labels;
+    fgColor = fg;
+    bgColor = bg;
+
+    // 매초 float → int 변환 대신 정수 테이블 사용
+    for (int i = 0; i < 360; i++) {
+        labelPos[i].x = (int16_t)labelX[i];
+        labelPos[i].y = (int16_t)labelY[i];
+        outerPos[i].x = (int16_t)outerX[i];
+        outerPos[i].y = (int16_t)outerY[i];
+        innerPos[i].x = (int16_t)innerX[i];
+        innerPos[i].y = (int16_t)innerY[i];
+    }
+    for (int i = 0; i < BEZEL_LABELS; i++) {
+        labelStartIdx[i] = labelStart[i];
+    }
+    for (int i = 0; i < BEZEL_DOTS; i++) {
+        dotStartIdx[i] = dotStart[i];
+    }
+
+    // 라벨 크기 → 타일 블록 하나로 할당
+    tileH = gfx->fontHeight(BEZEL_FONT);
+    uint8_t maxW = 0;
+    uint32_t total = 0;
+    for (int i = 0; i < BEZEL_LABELS; i++) {
+        tileW[i] = gfx->textWidth(labels[i], BEZEL_FONT);
+        tileOffset[i] = total;
+        total += tileW[i] * tileH;
+        maxW = max(maxW, tileW[i]);
+    }
+    if (total == 0) return false;
+
+    tiles = (uint16_t *)malloc(total * sizeof(uint16_t));
+    if (tiles == nullptr) {
+        _PL("Bezel: no RAM for tiles - drawString fallback");
+        return false;
+    }
+
+    // 임시 스프라이트에 라벨을 한 번씩 그려서 버퍼 복사
+    TFT_eSprite tmp(gfx);
+    tmp.setColorDepth(16);
+    tmp.setAttribute(PSRAM_ENABLE, false);
+    if (tmp.createSprite(maxW, tileH) == nullptr) {
+        release();
+        _PL("Bezel: no RAM for raster sprite - drawString fallback");
+        return false;
+    }
+
+    tmp.setTextDatum(TL_DATUM);
+    tmp.setTextColor(fg, bg);
+    const uint16_t *src = (const uint16_t *)tmp.getPointer();
+    for (int i = 0; i < BEZEL_LABELS; i++) {
+        tmp.fillSprite(bg);
+        tmp.drawString(labels[i], 0, 0, BEZEL_FONT);
+
+        uint16_t *dst = tiles + tileOffset[i];
+        for (int r = 0; r < tileH; r++) {
+            memcpy(dst + r * tileW[i], src + r * maxW, tileW[i] * sizeof(uint16_t));
+        }
+    }
+    tmp.deleteSprite();
+
+    cacheBytes = total * sizeof(uint16_t);
+    _PF("Bezel: %d labels cached (%u bytes)\n", BEZEL_LABELS, cacheBytes);
+    return true;
+}
+
+void BezelRing::release() {
+    free(tiles);
+    tiles = nullptr;
+    cacheBytes = 0;
+}
+
+// ============================================
+// Draw / Erase
+// ============================================
+void BezelRing::draw(UICanvas *tft, int angle, uint16_t tickColor) {
+    for (int i = 0; i < BEZEL_LABELS; i++) {
+        int idx = (labelStartIdx[i] + angle) % 360;
+        drawLabel(tft, i, labelPos[idx]);
+        tft->drawLine(outerPos[idx].x, outerPos[idx].y, innerPos[idx].x, innerPos[idx].y, tickColor);
+    }
+
+    for (int i = 0; i < BEZEL_DOTS; i++) {
+        int idx = (dotStartIdx[i] + angle) % 360;
+        tft->stampDot(outerPos[idx].x, outerPos[idx].y, 1, tickColor, bgColor);   // 🆕 3x3 블록 한 번
+    }
+}
+
+// 배경색 문자열로 덮던 기존 방식과 같은 영역 (라벨 박스 + 눈금 + 반경 2 점)
+void BezelRing::erase(UICanvas *tft, int angle) {
+    for (int i = 0; i < BEZEL_LABELS; i++) {
+        int idx = (labelStartIdx[i] + angle) % 360;
+        const RingPoint &c = labelPos[idx];
+        if (isCached()) {
+            tft->fillRect(c.x - tileW[i] / 2, c.y - tileH / 2, tileW[i], tileH, bgColor);
+        } else {
+            tft->setTextDatum(MC_DATUM);
+            tft->setTextColor(bgColor, bgColor);
+            tft->drawString(labelText[i], c.x, c.y, BEZEL_FONT);
+        }
+        tft->drawLine(outerPos[idx].x, outerPos[idx].y, innerPos[idx].x, innerPos[idx].y, bgColor);
+    }
+
+    for (int i = 0; i < BEZEL_DOTS; i++) {
+        int idx = (dotStartIdx[i] + angle) % 360;
+        tft->fillCircle(outerPos[idx].x, outerPos[idx].y, 2, bgColor);
+    }
+}
+
+// TFT_eSPI MC_DATUM과 같은 위치 (x - w/2, y - h/2)
+void BezelRing::drawLabel(UICanvas *tft, uint8_t i, const RingPoint &c) {
+    if (!isCached()) {
+        tft->setTextDatum(MC_DATUM);
+        tft->setTextColor(fgColor, bgColor);
+        tft->drawString(labelText[i], c.x, c.y, BEZEL_FONT);
+        return;
+    }
+    tft->pushRaw(c.x - tileW[i] / 2, c.y - tileH / 2, tileW[i], tileH, tiles + tileOffset[i]);
+}
@@ -0,0 +1,70 @@
+// ============================================
+// TTGO Watch Rotating Bezel Cache
+// Version: 2.4 - Pre-rasterized Bezel
+// ============================================
+#ifndef UI_BEZEL_H
+#define UI_BEZEL_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "UI-canvas.h"
+
+#define BEZEL_LABELS    12
+#define BEZEL_DOTS      60
+
+// ============================================
+// BezelRing
+//   - 숫자 라벨 12개를 setupDisplay 시점에 한 번만 래스터화 (폰트 디코딩 1회)
+//   - 360도 좌표는 정수 테이블로 보관
+//   - 매초 회전은 라벨 타일 복사 + 테이블 좌표 눈금/점 그리기만 수행
+// ============================================
+class BezelRing {
+public:
+    BezelRing();
+    ~BezelRing();
+
+    // labelX/Y: 라벨 중심, outerX/Y: 눈금 바깥쪽(점 위치), innerX/Y: 눈금 안쪽
+    bool build(TFT_eSPI *gfx, const String *labels,
+               const int *labelStart, const int *dotStart,
+               const float *labelX, const float *labelY,
+               const float *outerX, const float *outerY,
+               const float *innerX, const float *innerY,
+               uint16_t fg, uint16_t bg);
+    void release();
+
+    bool isCached() const { return tiles != nullptr; }
+
+    // angle: 0..359 회전 각도
+    void draw(UICanvas *tft, int angle, uint16_t tickColor);
+    void erase(UICanvas *tft, int angle);
+
+    uint32_t getCacheBytes() const { return cacheBytes; }
+
+private:
+    struct RingPoint {
+        int16_t x;
+        int16_t y;
+    };
+
+    const String *labelText;
+    uint16_t fgColor;
+    uint16_t bgColor;
+
+    // 라벨 타일 (스프라이트 버퍼 순서, 하나의 블록에 연속 저장)
+    uint16_t *tiles;
+    uint16_t tileOffset[BEZEL_LABELS];
+    uint8_t tileW[BEZEL_LABELS];
+    uint8_t tileH;
+    uint32_t cacheBytes;
+
+    // 정수 좌표 테이블
+    uint16_t labelStartIdx[BEZEL_LABELS];
+    uint16_t dotStartIdx[BEZEL_DOTS];
+    RingPoint labelPos[360];
+    RingPoint outerPos[360];
+    RingPoint innerPos[360];
+
+    void drawLabel(UICanvas *tft, uint8_t i, const RingPoint &c);
+};
+
+#endif // UI_BEZEL_H
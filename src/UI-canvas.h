@@ -0,0 +1,157 @@
+// ============================================
+// TTGO Watch Drawing Canvas
+// Version: 2.4 - Damage Tracking
+// ============================================
+#ifndef UI_CANVAS_H
+#define UI_CANVAS_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "UI-dirty.h"
+#include "UI-glyph.h"
+#include "UI-textmetrics.h"
+#include "UI-palette.h"
+#include "UI-displaylist.h"
+#include "UI-stamp.h"
+#include "UI-aafont.h"
+
+class GlyphStore;
+
+// ============================================
+// UICanvas
+//   - TFT_eSPI와 같은 이름의 그리기 함수 (화면 코드 변경 최소화)
+//   - 대상: 패널 또는 합성기 백버퍼 스프라이트
+//   - 그릴 때마다 경계 사각형을 DirtyRegion에 등록
+//   - 🆕 글리프 캐시가 있으면 내장 폰트 문자열을 타일 blit으로 그림
+//   - 🆕 문자열 폭/높이 캐시가 있으면 datum 정렬을 미리 계산해 글자만 그림
+//   - 🆕 팔레트가 있으면 (4bpp 백버퍼) 모든 색을 인덱스로 바꿔 그림
+//   - 🆕 beginList ~ endList 사이의 호출은 기록만 하고,
+//        endList에서 이전 프레임 목록과 비교해 결과가 바뀌는 op만 실행
+//   - 🆕 실행 시 이어 붙는 같은 색 fillRect는 창 하나로 합침
+//   - 🆕 작은 fillCircle은 DotStamp 행 테이블로 그림 (픽셀 동일)
+//   - 🆕 2bpp RLE 글리프 칸 (AAText, 4bpp 대상은 혼합색 없이)
+//   - 🆕 파일 저장소 글리프 칸 (GlyphStore, 한글)
+//   - 🆕 RLE 이미지 (고정 배경): 행마다 풀어서 한 줄씩 push
+//   - 🆕 배치 모드 (패널 직접 대상): endList 실행 전체를 SPI 트랜잭션 하나로
+// ============================================
+class UICanvas {
+public:
+    UICanvas();
+    explicit UICanvas(TFT_eSPI *target, DirtyRegion *damage = nullptr);
+    ~UICanvas();
+
+    void setTarget(TFT_eSPI *target);
+    void setDamage(DirtyRegion *damage) { dirty = damage; }
+    void setGlyphCache(GlyphCache *cache) { glyphs = cache; }
+    GlyphCache *getGlyphCache() const { return glyphs; }
+    void setMetricsCache(TextMetricsCache *cache) { metrics = cache; }
+    TextMetricsCache *getMetricsCache() const { return metrics; }
+    void setPalette(Palette16 *p) { palette = p; if (tft != nullptr) applyTextState(); }
+    TFT_eSPI *getTarget() const { return tft; }
+
+    // 텍스트 상태
+    void setTextDatum(uint8_t d);
+    void setTextColor(uint16_t fg);
+    void setTextColor(uint16_t fg, uint16_t bg);
+    void setTextFont(uint8_t font);
+    void setFreeFont(const GFXfont *font);
+    void setTextSize(uint8_t size);
+
+    // 도형
+    void fillScreen(uint32_t color);
+    void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+    void drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+    void drawCircle(int32_t x, int32_t y, int32_t r, uint32_t color);
+    void fillCircle(int32_t x, int32_t y, int32_t r, uint32_t color);
+    // 🆕 배경이 bg로 정해진 작은 점: (2r+1)² 블록 한 번 쓰기 (원 밖 픽셀도 bg로 덮음)
+    void stampDot(int32_t x, int32_t y, int32_t r, uint16_t color, uint16_t bg);
+    void drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color);
+    // 🆕 AA 글리프 칸 (x, top = 칸 왼쪽 위, 배경까지 칸 전체를 씀)
+    void drawAAGlyph(const AAFont *font, char c, int32_t x, int32_t top, uint16_t fg, uint16_t bg);
+    // 🆕 저장소 글리프 칸 (코드포인트 + GlyphStore::drawString이 구한 칸 폭, 0이면 그리지 않음)
+    void drawStoreGlyph(GlyphStore *store, uint16_t cp, uint8_t w, int32_t x, int32_t top,
+                        uint16_t fg, uint16_t bg);
+    void fillTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1,
+                      int32_t x2, int32_t y2, uint32_t color);
+
+    // 🆕 스프라이트 버퍼 순서(바이트 스왑) 이미지 복사 - 대상의 스왑 설정과 무관
+    //    기록 모드에서는 포인터로 비교하므로 내용이 바뀌지 않는 버퍼만 사용
+    void pushRaw(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data);
+    // 🆕 RLE 이미지: (길이, 색) 쌍, run은 행을 넘지 않음, 색은 스프라이트 버퍼 순서 (w <= SCREEN_WIDTH)
+    void pushRuns(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *runs);
+
+    // 텍스트 (font 생략 시 현재 폰트)
+    int16_t drawString(const char *str, int32_t x, int32_t y);
+    int16_t drawString(const char *str, int32_t x, int32_t y, uint8_t font);
+    int16_t drawString(const String &str, int32_t x, int32_t y) { return drawString(str.c_str(), x, y); }
+    int16_t drawString(const String &str, int32_t x, int32_t y, uint8_t font) { return drawString(str.c_str(), x, y, font); }
+
+    // 🆕 Display List (프레임 단위)
+    void beginList();
+    void endList();
+    void resetList();    // 대상이 외부에서 바뀜 → 다음 프레임은 전부 실행
+    uint16_t getLastRecorded() const { return lastRecorded; }
+    uint16_t getLastEmitted() const { return lastEmitted; }
+
+    // 🆕 SPI 배치 (대상이 패널일 때만 켬 - 스프라이트는 SPI를 쓰지 않음)
+    void setBatching(bool on) { batching = on; }
+    bool isBatching() const { return batching; }
+    uint32_t getSavedTransactions() const { return savedTx; }
+    uint32_t getMergedFills() const { return mergedFills; }
+    void resetBatchStats() { savedTx = 0; mergedFills = 0; }
+
+private:
+    TFT_eSPI *tft;
+    DirtyRegion *dirty;
+    GlyphCache *glyphs;
+    TextMetricsCache *metrics;
+    Palette16 *palette;
+
+    // 텍스트 상태 (대상과 항상 같게 유지)
+    TextState text;
+
+    // 기록 상태: lists[cur] = 이번 프레임, lists[cur ^ 1] = 대상에 반영된 이전 프레임
+    //   목록 2개가 ~10KB → 처음 beginList 때 힙에 할당 (밴드용 임시 캔버스는 스택에 만듦)
+    DisplayList *lists;
+    uint8_t cur;
+    bool recording;
+    bool prevValid;
+    uint16_t submitted;
+    uint16_t executed;
+    uint16_t lastRecorded;
+    uint16_t lastEmitted;
+
+    // 배치 상태: 열린 트랜잭션 안에서 primitive가 각자 열었을 트랜잭션 수
+    bool batching;
+    bool inBatch;
+    uint16_t batchTx;
+    uint32_t savedTx;
+    uint32_t mergedFills;
+
+    void applyTextState();
+    uint32_t ink(uint32_t color) { return palette != nullptr ? palette->indexOf(color) : color; }
+
+    void submit(DrawOp op, uint16_t color, int16_t p0, int16_t p1, int16_t p2 = 0,
+                int16_t p3 = 0, int16_t p4 = 0, int16_t p5 = 0, const uint16_t *data = nullptr);
+    int16_t submitText(const char *str, int32_t x, int32_t y, uint8_t font);
+    void flushRecorded();
+    void emitList(const DisplayList &list, const bool *emit);
+    void countTx(uint16_t n) { if (inBatch) batchTx += n; }
+
+    // 실제 그리기
+    void execute(const DisplayList &list, const DisplayOp &op);
+    void executeShape(const DisplayOp &op);
+    int16_t executeText(const TextState &state, const char *str, int32_t x, int32_t y, uint8_t font);
+    void rawPixels(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data);
+    void rawRuns(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *runs);
+
+    void measure(const char *str, uint8_t font, int16_t &w, int16_t &h);
+    int16_t drawMeasured(const char *str, int32_t x, int32_t y, uint8_t font);
+    void alignText(int16_t w, int16_t h, int32_t &x, int32_t &y) const;
+    DirtyRect textBounds(int16_t w, int16_t h, int32_t x, int32_t y) const;
+    bool blitString(const char *str, int32_t x, int32_t y, uint8_t font, int16_t &width);
+
+    void mark(int32_t x, int32_t y, int32_t w, int32_t h);
+};
+
+#endif // UI_CANVAS_H
@@ -0,0 +1,111 @@
+// ============================================
+// TTGO Watch Sprite Compositor
+// Version: 2.4 - Off-screen Compositing
+// ============================================
+#ifndef UI_COMPOSITOR_H
+#define UI_COMPOSITOR_H
+
+#include <Arduino.h>
+#include <functional>
+#include "config.h"
+#include "UI-dirty.h"
+#include "UI-palette.h"
+
+// ============================================
+// SpriteCompositor
+//   - PSRAM 있음: 240x240 백버퍼 + 프론트 사본 → 픽셀 단위 diff push
+//   - PSRAM 없음: 240xN 밴드 스프라이트 → 세그먼트 해시 diff push
+//   🆕 PSRAM 없음 + USE_PALETTE_FRAMEBUFFER: 240x240 4bpp 백버퍼 (28.8KB)
+//      → 인덱스 diff, push 중에 팔레트로 RGB565 확장
+//   어느 쪽이든 패널에는 완성된 결과만 한 번 올라감 (검정 덧칠 없음)
+//   🆕 큰 변경은 밴드 2개를 번갈아 DMA 전송 (CPU 그리기와 SPI 전송 겹침)
+// ============================================
+class SpriteCompositor {
+public:
+    // repaint == true 이면 대상 버퍼가 비어 있으므로 전체를 다시 그려야 함
+    typedef std::function<void(TFT_eSPI *gfx, bool repaint)> PaintFn;
+
+    SpriteCompositor();
+    ~SpriteCompositor();
+
+    bool begin(TFT_eSPI *panel);
+    void end();
+
+    bool isReady() const { return tft != nullptr; }
+    bool isBanded() const { return banded; }
+    bool isDmaEnabled() const { return dmaReady; }
+    bool isPaletted() const { return paletted; }
+
+    // 🆕 4bpp 모드의 색 인덱스 변환 (다른 모드는 nullptr)
+    Palette16 *palette() { return paletted ? &pal : nullptr; }
+
+    // 패널이 외부에서 단색으로 지워졌을 때 호출
+    void invalidate(uint16_t panelColor);
+
+    // 🆕 밴드 모드 화면 전환용: 패널 전체를 DMA로 칠함 (마지막 밴드는 대기 안 함)
+    void fillPanel(uint16_t color);
+
+    // 🆕 진행 중인 DMA 완료 대기 + SPI 트랜잭션 종료
+    //    패널에 직접 그리기 전에 반드시 호출
+    void sync();
+
+    // 그리기 → diff → push
+    void compose(const PaintFn &paint);
+
+    // 🆕 전체 모드: 백버퍼에 직접 그린 뒤 손상 영역만 diff → push
+    //    4bpp 모드의 백버퍼는 색 대신 팔레트 인덱스로 그려야 함 (UICanvas::setPalette)
+    TFT_eSprite *frame() { return banded ? nullptr : canvas; }
+    void present(const DirtyRegion &dirty);
+
+    // 통계 (마지막 compose / present 기준)
+    uint32_t getLastPushBytes() const { return lastPushBytes; }
+    uint32_t getLastPushPixels() const { return lastPushPixels; }
+    uint16_t getLastSpanCount() const { return lastSpanCount; }
+    uint16_t getLastDmaBands() const { return lastDmaBands; }
+
+private:
+    TFT_eSPI *tft;
+    TFT_eSprite *canvas;      // 전체 모드: 240x240 백버퍼 (PSRAM)
+    TFT_eSprite *strip[2];    // 밴드 모드: 핑퐁 밴드 스프라이트 (내부 RAM)
+    uint16_t *bounce[2];      // 전체 모드: PSRAM → DMA 중계 버퍼
+    uint16_t *front;          // 전체 모드: 패널에 올라간 내용 사본
+    uint32_t *segHash;        // 밴드 모드: 행 x 세그먼트 해시
+    uint8_t *front4;          // 🆕 4bpp 모드: 패널에 올라간 인덱스 사본
+    Palette16 pal;
+    uint32_t pushedVersion;   // 패널에 올라간 팔레트 버전
+    bool banded;
+    bool paletted;
+    int16_t bandHeight;
+    uint16_t clearColor;
+
+    // SPI / DMA 상태
+    bool dmaReady;
+    bool dmaBusy;
+    const uint16_t *dmaSrc;   // 🆕 마지막 DMA 전송의 소스 (밴드 재사용 전 확인)
+    bool txOpen;
+    bool oldSwap;
+
+    uint32_t lastPushBytes;
+    uint32_t lastPushPixels;
+    uint16_t lastSpanCount;
+    uint16_t lastDmaBands;
+
+    void beginPush();
+    void endPush();
+    void waitDma();
+
+    void pushSpan(const uint16_t *src, int16_t x, int16_t y, int16_t w);
+    void pushRows(uint16_t *src, int16_t y, int16_t rows);
+    void resetStats();
+
+    void diffRect(const uint16_t *back, const DirtyRect &r);
+    void streamRows(const uint16_t *back, int16_t y0, int16_t y1);
+    void diffBand(uint16_t *band, int16_t y0, int16_t rows);
+    bool beginPaletted(TFT_eSPI *panel);
+    void diffRect4(const DirtyRect &r);
+    void streamRows4(int16_t y0, int16_t y1);
+    uint32_t hashSegment(const uint16_t *px) const;
+    uint32_t solidHash(uint16_t color) const;
+};
+
+#endif // UI_COMPOSITOR_H
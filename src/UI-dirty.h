@@ -0,0 +1,82 @@
+// ============================================
+// TTGO Watch Dirty Rectangle Tracker
+// Version: 2.4 - Damage Tracking
+// ============================================
+#ifndef UI_DIRTY_H
+#define UI_DIRTY_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// ============================================
+// Dirty Rect
+// ============================================
+struct DirtyRect {
+    int16_t x;
+    int16_t y;
+    int16_t w;
+    int16_t h;
+
+    int32_t area() const { return (int32_t)w * h; }
+    int16_t right() const { return x + w; }
+    int16_t bottom() const { return y + h; }
+
+    bool contains(const DirtyRect &o) const {
+        return o.x >= x && o.y >= y && o.right() <= right() && o.bottom() <= bottom();
+    }
+    bool touches(const DirtyRect &o) const {
+        return o.x <= right() && o.right() >= x && o.y <= bottom() && o.bottom() >= y;
+    }
+    bool overlaps(const DirtyRect &o) const {
+        return o.x < right() && o.right() > x && o.y < bottom() && o.bottom() > y;
+    }
+    DirtyRect unite(const DirtyRect &o) const {
+        int16_t l = min(x, o.x);
+        int16_t t = min(y, o.y);
+        return { l, t, (int16_t)(max(right(), o.right()) - l), (int16_t)(max(bottom(), o.bottom()) - t) };
+    }
+};
+
+// ============================================
+// DirtyRegion
+//   - 그리기 함수가 건드린 영역을 등록
+//   - 겹치거나 붙은 사각형은 낭비가 작을 때 병합
+//   - 프레임마다 flush 후 clear, 통계는 마지막 프레임 기준
+// ============================================
+class DirtyRegion {
+public:
+    DirtyRegion();
+
+    void add(int16_t x, int16_t y, int16_t w, int16_t h);
+    void addAll();
+    void clear();
+
+    bool isEmpty() const { return count == 0; }
+    uint8_t getCount() const { return count; }
+    const DirtyRect &getRect(uint8_t i) const { return rects[i]; }
+    int32_t getArea() const;     // 🆕 겹친 픽셀은 한 번만 (합집합)
+    bool intersects(const DirtyRect &r) const;
+
+    // 프레임 종료 (flush 직후) - 통계 저장 후 비움
+    void endFrame();
+
+    // 모니터링용 (마지막 프레임)
+    int32_t getLastArea() const { return lastArea; }
+    uint8_t getLastCount() const { return lastCount; }
+    uint32_t getFrameCount() const { return frameCount; }
+
+private:
+    DirtyRect rects[DIRTY_MAX_RECTS];
+    uint8_t count;
+
+    int32_t lastArea;
+    uint8_t lastCount;
+    uint32_t frameCount;
+
+    void insert(DirtyRect r);
+    void removeAt(uint8_t i);
+    static int32_t mergeWaste(const DirtyRect &a, const DirtyRect &b);
+    static void sortEdges(int16_t *v, uint8_t n);
+};
+
+#endif // UI_DIRTY_H
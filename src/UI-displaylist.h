@@ -0,0 +1,98 @@
+// ============================================
+// TTGO Watch Display List
+// Version: 2.4 - Recorded Drawing
+// ============================================
+#ifndef UI_DISPLAYLIST_H
+#define UI_DISPLAYLIST_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "UI-dirty.h"
+
+// ============================================
+// Draw Op
+// ============================================
+enum class DrawOp : uint8_t {
+    FILL_SCREEN,
+    FILL_RECT,
+    DRAW_RECT,
+    DRAW_CIRCLE,
+    FILL_CIRCLE,
+    STAMP_DOT,      // 🆕 p[3] = 배경색 (원 밖까지 정사각형으로 씀)
+    AA_GLYPH,       // 🆕 x, top, w, h, 배경색, 글자 / data = AAFont
+    STORE_GLYPH,    // 🆕 x, top, w, h, 배경색, 코드포인트 / data = GlyphStore
+    DRAW_LINE,
+    FILL_TRIANGLE,
+    PUSH_RAW,
+    PUSH_RUNS,      // 🆕 x, y, w, h / data = (길이, 색) 쌍 (행마다 끊김)
+    TEXT
+};
+
+// UICanvas가 추적하는 텍스트 상태 (TEXT op마다 함께 저장)
+struct TextState {
+    const GFXfont *gfx;     // Free Font (nullptr이면 내장 폰트)
+    uint16_t fg;
+    uint16_t bg;
+    uint8_t datum;
+    uint8_t font;
+    uint8_t size;
+
+    bool operator==(const TextState &o) const {
+        return gfx == o.gfx && fg == o.fg && bg == o.bg &&
+               datum == o.datum && font == o.font && size == o.size;
+    }
+};
+
+// 24바이트 - 좌표 의미는 op마다 다름
+//   RECT/PUSH_RAW/PUSH_RUNS/AA_GLYPH/STORE_GLYPH: x, y, w, h   CIRCLE: x, y, r   LINE: x0, y0, x1, y1
+//   TRIANGLE: x0..y2            TEXT: x, y, 경계(x, y, w, h)
+struct DisplayOp {
+    DrawOp op;
+    uint8_t font;           // TEXT: drawString의 font 인자 (0 = 현재 폰트)
+    uint16_t color;
+    int16_t p[6];
+    uint16_t text;          // TEXT: 문자열 영역 오프셋 (TextState + 문자열)
+    uint16_t textLen;
+    const uint16_t *data;   // PUSH_RAW/PUSH_RUNS: 내용이 바뀌지 않는 이미지, AA_GLYPH/STORE_GLYPH: 폰트 (포인터로 비교)
+
+    DirtyRect bounds() const;
+};
+
+// op 개수와 문자열 오프셋은 uint16_t
+static_assert(DLIST_MAX_OPS <= 65535, "DLIST_MAX_OPS must fit in uint16_t");
+static_assert(DLIST_TEXT_BYTES <= 65535, "DLIST_TEXT_BYTES must fit in uint16_t");
+
+// ============================================
+// DisplayList
+//   - 한 프레임의 그리기 호출 기록
+//   - 이전 프레임 목록과 비교 → 결과가 바뀔 수 있는 op만 표시
+//     (바뀐/사라진 op 영역에 닿는 op는 변경이 없어도 순서대로 다시 실행)
+// ============================================
+class DisplayList {
+public:
+    DisplayList();
+
+    void clear();
+
+    // 가득 차면 false (호출 측이 즉시 실행으로 전환)
+    bool add(const DisplayOp &op);
+    bool addText(DisplayOp op, const TextState &state, const char *str);
+
+    uint16_t size() const { return count; }
+    const DisplayOp &at(uint16_t i) const { return ops[i]; }
+    TextState stateOf(const DisplayOp &op) const;
+    const char *stringOf(const DisplayOp &op) const;
+
+    // emit[i] = 이번 프레임에 실행할 op, 실행할 개수 반환
+    uint16_t diff(const DisplayList &prev, bool *emit) const;
+
+private:
+    DisplayOp ops[DLIST_MAX_OPS];
+    uint16_t count;
+    char text[DLIST_TEXT_BYTES];
+    uint16_t textUsed;
+
+    bool same(const DisplayOp &a, const DisplayList &other, const DisplayOp &b) const;
+};
+
+#endif // UI_DISPLAYLIST_H
@@ -0,0 +1,296 @@
+// ============================================
+// TTGO Watch Hangul Glyph Store Implementation
+// Version: 2.4 - LittleFS Glyph Streaming
+// ============================================
+
+#include "UI-glyphstore.h"
+
+#define STORE_HEADER_BYTES  16
+#define STORE_ENTRY_BYTES   8
+#define STORE_BLOCK_PIXELS  512     // 한 번에 pushImage하는 픽셀 수 (스택 1KB)
+
+static uint16_t le16(const uint8_t *p) { return p[0] | (p[1] << 8); }
+static uint32_t le32(const uint8_t *p) { return p[0] | (p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24); }
+
+GlyphStore::GlyphStore() {
+    ready = false;
+    count = 0;
+    height = 0;
+    ascent = 0;
+    indexOffset = 0;
+    bitmapOffset = 0;
+    useClock = 0;
+    for (int i = 0; i < GLYPH_STORE_SLOTS; i++) {
+        slots[i].used = false;
+    }
+    resetStats();
+}
+
+GlyphStore::~GlyphStore() {
+    end();
+}
+
+// ============================================
+// Open - 헤더만 읽음 (색인/비트맵은 필요할 때)
+// ============================================
+bool GlyphStore::begin(const char *path) {
+    end();
+
+    if (!LittleFS.begin(false)) {
+        _PL("Glyph store: LittleFS mount failed");
+        return false;
+    }
+    file = LittleFS.open(path, "r");
+    if (!file) {
+        _PF("Glyph store: %s not found - English labels\n", path);
+        return false;
+    }
+
+    uint8_t h[STORE_HEADER_BYTES];
+    if (!readAt(0, h, sizeof(h)) || memcmp(h, "GST1", 4) != 0) {
+        _PL("Glyph store: bad header");
+        file.close();
+        return false;
+    }
+
+    count = le16(h + 4);
+    height = h[6];
+    ascent = h[7];
+    indexOffset = le32(h + 8);
+    bitmapOffset = le32(h + 12);
+    if (count == 0 || height == 0 ||
+        indexOffset + (uint32_t)count * STORE_ENTRY_BYTES > file.size()) {
+        _PL("Glyph store: bad index");
+        file.close();
+        return false;
+    }
+
+    ready = true;
+    _PF("Glyph store: %u glyphs, %upx cells, %d RAM slots\n", count, height, GLYPH_STORE_SLOTS);
+    return true;
+}
+
+void GlyphStore::end() {
+    if (file) file.close();
+    ready = false;
+    useClock = 0;
+    for (int i = 0; i < GLYPH_STORE_SLOTS; i++) {
+        slots[i].used = false;
+    }
+}
+
+// ============================================
+// Text
+// ============================================
+uint16_t GlyphStore::nextCodepoint(const char *&s) {
+    uint8_t c = (uint8_t)*s++;
+    if (c < 0x80) return c;
+
+    // 2바이트 (110xxxxx) / 3바이트 (1110xxxx), 그 외는 BMP 밖이거나 잘못된 바이트
+    uint8_t extra = (c & 0xE0) == 0xC0 ? 1 : (c & 0xF0) == 0xE0 ? 2 : 0;
+    if (extra == 0) return '?';
+
+    uint16_t cp = c & (extra == 1 ? 0x1F : 0x0F);
+    for (uint8_t i = 0; i < extra; i++) {
+        if (((uint8_t)*s & 0xC0) != 0x80) return '?';
+        cp = (cp << 6) | ((uint8_t)*s++ & 0x3F);
+    }
+    return cp;
+}
+
+uint8_t GlyphStore::advance(uint16_t cp) {
+    const Slot *g = glyphFor(cp);
+    return g != nullptr ? g->advance : 0;
+}
+
+int16_t GlyphStore::textWidth(const char *utf8) {
+    return measure(utf8, false);
+}
+
+int16_t GlyphStore::measure(const char *utf8, bool counted) {
+    int16_t w = 0;
+    while (*utf8 != '\0') {
+        const Slot *g = glyphFor(nextCodepoint(utf8), counted);
+        if (g != nullptr) w += g->advance;
+    }
+    return w;
+}
+
+int16_t GlyphStore::drawString(UICanvas *tft, const char *utf8, int32_t x, int32_t y, uint8_t datum,
+                               uint16_t fg, uint16_t bg) {
+    if (!ready) return 0;
+
+    // 🆕 글자마다 첫 조회(폭 계산)만 적중률에 셈 → 아래 그리기/op 실행은 다시 세지 않음
+    int16_t w = measure(utf8, true);
+    switch (datum) {
+        case TC_DATUM: x -= w / 2; break;
+        case TR_DATUM: x -= w; break;
+        case ML_DATUM: y -= height / 2; break;
+        case MC_DATUM: x -= w / 2; y -= height / 2; break;
+        case MR_DATUM: x -= w; y -= height / 2; break;
+        case BL_DATUM: case L_BASELINE: y -= height; break;
+        case BC_DATUM: case C_BASELINE: x -= w / 2; y -= height; break;
+        case BR_DATUM: case R_BASELINE: x -= w; y -= height; break;
+        default: break;
+    }
+
+    while (*utf8 != '\0') {
+        uint16_t cp = nextCodepoint(utf8);
+        uint8_t adv = advance(cp);
+        if (adv == 0) continue;     // 저장소에 없는 글자는 건너뜀
+
+        tft->drawStoreGlyph(this, cp, adv, x, y, fg, bg);
+        x += adv;
+    }
+    return w;
+}
+
+// ============================================
+// Glyph Cells
+// ============================================
+int16_t GlyphStore::draw(TFT_eSPI *tft, uint16_t cp, int32_t x, int32_t top, uint16_t fg, uint16_t bg) {
+    const Slot *g = glyphFor(cp);
+    if (g == nullptr) return 0;
+
+    // 스프라이트 버퍼 순서 (바이트 스왑)
+    uint16_t on = (fg >> 8) | (fg << 8);
+    uint16_t off = (bg >> 8) | (bg << 8);
+
+    int32_t w = g->advance;
+    int32_t stride = (w + 7) / 8;
+    int32_t rowsPerBlock = STORE_BLOCK_PIXELS / w;
+
+    uint16_t block[STORE_BLOCK_PIXELS];
+    bool oldSwap = tft->getSwapBytes();
+    tft->setSwapBytes(false);
+
+    for (int32_t y = 0; y < height; y += rowsPerBlock) {
+        int32_t rows = min(rowsPerBlock, (int32_t)height - y);
+        uint16_t *p = block;
+        for (int32_t j = 0; j < rows; j++) {
+            const uint8_t *row = g->bits + (y + j) * stride;
+            for (int32_t i = 0; i < w; i++) {
+                *p++ = (row[i >> 3] & (0x80 >> (i & 7))) ? on : off;
+            }
+        }
+        tft->pushImage(x, top + y, w, rows, block);
+    }
+
+    tft->setSwapBytes(oldSwap);
+    return w;
+}
+
+// 4bpp 팔레트 대상: 배경 한 번 + 행마다 켜진 구간만 가로선
+int16_t GlyphStore::drawSolid(TFT_eSPI *tft, uint16_t cp, int32_t x, int32_t top, uint32_t fg, uint32_t bg) {
+    const Slot *g = glyphFor(cp);
+    if (g == nullptr) return 0;
+
+    int32_t w = g->advance;
+    int32_t stride = (w + 7) / 8;
+    tft->fillRect(x, top, w, height, bg);
+
+    for (int32_t j = 0; j < height; j++) {
+        const uint8_t *row = g->bits + j * stride;
+        int32_t i = 0;
+        while (i < w) {
+            if (!(row[i >> 3] & (0x80 >> (i & 7)))) {
+                i++;
+                continue;
+            }
+            int32_t start = i;
+            while (i < w && (row[i >> 3] & (0x80 >> (i & 7)))) i++;
+            tft->drawFastHLine(x + start, top + j, i - start, fg);
+        }
+    }
+    return w;
+}
+
+// ============================================
+// Stats
+// ============================================
+uint8_t GlyphStore::getHitRate() const {
+    uint32_t total = hits + misses;
+    return total == 0 ? 0 : (uint8_t)(hits * 100 / total);
+}
+
+uint8_t GlyphStore::getUsedSlots() const {
+    uint8_t n = 0;
+    for (int i = 0; i < GLYPH_STORE_SLOTS; i++) {
+        if (slots[i].used) n++;
+    }
+    return n;
+}
+
+void GlyphStore::resetStats() {
+    hits = 0;
+    misses = 0;
+    evictions = 0;
+}
+
+// ============================================
+// Cache / File
+// ============================================
+const GlyphStore::Slot *GlyphStore::glyphFor(uint16_t cp, bool counted) {
+    if (!ready) return nullptr;
+
+    for (int i = 0; i < GLYPH_STORE_SLOTS; i++) {
+        Slot &s = slots[i];
+        if (s.used && s.cp == cp) {
+            if (counted) hits++;
+            s.lastUse = ++useClock;
+            return s.found ? &s : nullptr;
+        }
+    }
+
+    if (counted) misses++;
+    Slot &s = slots[victimSlot()];
+    s.used = true;
+    s.cp = cp;
+    s.lastUse = ++useClock;
+    s.advance = 0;
+
+    uint32_t offset;
+    s.found = findEntry(cp, s.advance, offset) && s.advance > 0 &&
+              (uint32_t)((s.advance + 7) / 8) * height <= GLYPH_STORE_MAX_BYTES &&
+              readAt(bitmapOffset + offset, s.bits, ((s.advance + 7) / 8) * height);
+    return s.found ? &s : nullptr;
+}
+
+// 색인은 코드포인트 오름차순 → 파일 위에서 이진 탐색 (한글 11,172자 + ASCII 기준 최대 14번 읽기)
+bool GlyphStore::findEntry(uint16_t cp, uint8_t &adv, uint32_t &offset) {
+    int32_t lo = 0;
+    int32_t hi = (int32_t)count - 1;
+    uint8_t e[STORE_ENTRY_BYTES];
+
+    while (lo <= hi) {
+        int32_t mid = (lo + hi) / 2;
+        if (!readAt(indexOffset + (uint32_t)mid * STORE_ENTRY_BYTES, e, sizeof(e))) return false;
+
+        uint16_t key = le16(e);
+        if (key == cp) {
+            adv = e[2];
+            offset = le32(e + 4);
+            return true;
+        }
+        if (key < cp) {
+            lo = mid + 1;
+        } else {
+            hi = mid - 1;
+        }
+    }
+    return false;
+}
+
+bool GlyphStore::readAt(uint32_t pos, uint8_t *buf, size_t len) {
+    return file.seek(pos) && file.read(buf, len) == len;
+}
+
+int GlyphStore::victimSlot() {
+    int victim = 0;
+    for (int i = 0; i < GLYPH_STORE_SLOTS; i++) {
+        if (!slots[i].used) return i;
+        if (slots[i].lastUse < slots[victim].lastUse) victim = i;
+    }
+    evictions++;
+    return victim;
+}
@@ -0,0 +1,100 @@
+// ============================================
+// TTGO Watch Screen Snapshot Cache Implementation
+// Version: 2.4 - Instant Transitions
+// ============================================
+
+#include "UI-screencache.h"
+
+static const size_t frameBytes = SCREEN_WIDTH * SCREEN_HEIGHT * sizeof(uint16_t);
+
+// ============================================
+// Constructor / Destructor
+// ============================================
+ScreenCache::ScreenCache() {
+    for (uint8_t i = 0; i < SCREEN_CACHE_SLOTS; i++) {
+        pixels[i] = nullptr;
+        tags[i] = 0;
+        valid[i] = false;
+    }
+    enabled = false;
+    hits = 0;
+    misses = 0;
+    captures = 0;
+}
+
+ScreenCache::~ScreenCache() {
+    end();
+}
+
+bool ScreenCache::begin() {
+    end();
+
+    // 슬롯 하나가 112.5KB - 내부 RAM에는 두지 않음
+    enabled = psramFound();
+    _PF("Screen cache: %s (%d slots x %u bytes)\n",
+        enabled ? "PSRAM" : "disabled", SCREEN_CACHE_SLOTS, (unsigned)frameBytes);
+    return enabled;
+}
+
+void ScreenCache::end() {
+    for (uint8_t i = 0; i < SCREEN_CACHE_SLOTS; i++) {
+        free(pixels[i]);
+        pixels[i] = nullptr;
+        valid[i] = false;
+    }
+    enabled = false;
+}
+
+// ============================================
+// Capture / Restore
+// ============================================
+bool ScreenCache::capture(uint8_t slot, const uint16_t *frame, uint32_t tag) {
+    if (!enabled || slot >= SCREEN_CACHE_SLOTS || frame == nullptr) return false;
+
+    if (pixels[slot] == nullptr) {
+        pixels[slot] = (uint16_t *)ps_malloc(frameBytes);
+        if (pixels[slot] == nullptr) {
+            _PF("Screen cache: slot %u alloc failed\n", slot);
+            return false;
+        }
+    }
+
+    memcpy(pixels[slot], frame, frameBytes);
+    tags[slot] = tag;
+    valid[slot] = true;
+    captures++;
+    return true;
+}
+
+bool ScreenCache::restore(uint8_t slot, uint16_t *frame, uint32_t tag) {
+    if (!enabled || slot >= SCREEN_CACHE_SLOTS || frame == nullptr) return false;
+
+    if (!valid[slot] || tags[slot] != tag) {
+        misses++;
+        return false;
+    }
+
+    memcpy(frame, pixels[slot], frameBytes);
+    hits++;
+    return true;
+}
+
+void ScreenCache::drop(uint8_t slot) {
+    if (slot < SCREEN_CACHE_SLOTS) {
+        valid[slot] = false;
+    }
+}
+
+void ScreenCache::clear() {
+    for (uint8_t i = 0; i < SCREEN_CACHE_SLOTS; i++) {
+        valid[i] = false;
+    }
+}
+
+uint8_t ScreenCache::getUsedSlots() const {
+    uint8_t n = 0;
+    for (uint8_t i = 0; i < SCREEN_CACHE_SLOTS; i++) {
+        if (valid[i]) n++;
+    }
+    return n;
+}
@@ -0,0 +1,91 @@
+// ============================================
+// TTGO Watch Hardware Scroll List
+// Version: 2.4 - Vertical Scroll List
+// ============================================
+#ifndef UI_SCROLL_H
+#define UI_SCROLL_H
+
+#include <Arduino.h>
+#include <functional>
+#include "config.h"
+#include "UI-canvas.h"
+
+// ============================================
+// ScrollList
+//   - ST7789 세로 스크롤 (VSCRDEF/VSCSAD)로 목록 창을 링 버퍼처럼 사용
+//   - 내용 행 c는 항상 창의 (c mod 창 높이) 행에 저장 → 스크롤은 시작 주소만 바꿈
+//   - 새로 드러난 행만 작은 스프라이트 띠로 그려 패널에 직접 push
+//   - 창 밖(헤더/하단)은 고정 영역이라 평소처럼 canvas로 그림
+//   - 회전 0/2만 하드웨어 스크롤, 그 외엔 창 전체를 띠 단위로 다시 그림
+// ============================================
+class ScrollList {
+public:
+    // (tft, index, cy): 항목 중심 y에 항목 하나를 그림 (배경은 이미 지워짐)
+    typedef std::function<void(UICanvas *tft, uint16_t index, int16_t cy)> ItemFn;
+
+    ScrollList();
+    ~ScrollList();
+
+    // 논리 행 [top, top + height)를 스크롤 창으로 사용
+    bool begin(TFT_eSPI *panel, uint8_t rotation, int16_t top, int16_t height,
+               int16_t itemHeight, uint16_t bg);
+    void setItems(uint16_t count, const ItemFn &drawItem);
+    void setMetricsCache(TextMetricsCache *cache) { metrics = cache; }   // 🆕 띠 캔버스에 전달
+
+    // 화면을 새로 그릴 때: 맨 위로 되돌리고 창 전체를 canvas로 그림
+    void drawAll(UICanvas *tft);
+
+    // 터치 드래그 → 스크롤 (손가락이 올라가면 목록도 올라감)
+    void onTouch(bool pressed, bool wasPressed, int16_t y);
+    bool wasDragged() const { return dragged; }
+    void scrollBy(int16_t dy);
+
+    // 새로 드러난 행만 패널에 직접 그림 (호출 전 DMA가 끝나 있어야 함)
+    void render();
+
+    // 하드웨어 스크롤 해제 (화면 전환 전 호출)
+    void end();
+
+    // 화면 y → 항목 번호 (창 밖이거나 항목 없음 = -1)
+    int16_t itemAt(int16_t y) const;
+
+    // 통계
+    uint16_t getLastRows() const { return lastRows; }
+    uint32_t getScrolls() const { return scrolls; }
+
+private:
+    TFT_eSPI *tft;
+    TFT_eSprite *band;
+    bool hardware;
+    bool flipped;       // 회전 2: 논리 y가 GRAM 239 - y 행
+    bool defined;       // VSCRDEF 전송 여부
+
+    int16_t top;
+    int16_t height;
+    int16_t itemHeight;
+    int16_t memTop;     // 창의 첫 GRAM 행 (회전 반영)
+    uint16_t bgColor;
+
+    uint16_t count;
+    ItemFn drawItem;
+    TextMetricsCache *metrics;
+
+    int16_t offset;     // 목표 스크롤 위치 (내용 px)
+    int16_t shown;      // 패널에 반영된 스크롤 위치
+
+    bool dragged;
+    int16_t dragStartY;
+    int16_t dragLastY;
+
+    uint16_t lastRows;
+    uint32_t scrolls;
+
+    int16_t maxOffset() const;
+    int16_t slotOf(int16_t row) const;
+    void paintRows(int16_t first, int16_t rows, int16_t y);
+    void exposeRows(int16_t first, int16_t last);
+    void setStart(int16_t scroll);
+    void defineArea(uint16_t tfa, uint16_t vsa, uint16_t bfa);
+};
+
+#endif // UI_SCROLL_H
@@ -0,0 +1,83 @@
+// ============================================
+// TTGO Watch Seven-Segment Readout
+// Version: 2.4 - Segment Diff Rendering
+// ============================================
+#ifndef UI_SEGMENT_H
+#define UI_SEGMENT_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "UI-canvas.h"
+
+#define SEGMENT_MAX_RUNS    8       // 한 행에서 동시에 추적하는 사각형 수
+
+// ============================================
+// SegmentReadout
+//   - DSEG7 GFX 폰트의 글리프 비트맵을 직접 읽음
+//   - 이전/새 글자의 비트맵 차이만 칠함 (켜지는 세그먼트 = fg, 꺼지는 세그먼트 = bg)
+//   - 행별 run을 세로로 이어 붙여 세그먼트 단위 사각형으로 출력
+//   - 자리 간격은 xAdvance 고정 (폭이 다른 글자로 문자열이 흔들리지 않음)
+//   - 🆕 AA 글리프가 있으면 바뀐 자리의 칸 전체를 2bpp RLE로 다시 씀 (칸이 배경까지 덮음)
+// ============================================
+class SegmentReadout {
+public:
+    SegmentReadout();
+
+    // (cx, cy): MC_DATUM 기준 중심
+    void begin(const GFXfont *gfxFont, int16_t cx, int16_t cy);
+
+    // 🆕 같은 폰트에서 생성한 AA 글리프 (nullptr = 1bpp 세그먼트 diff)
+    void setSmoothFont(const AAFont *aa) { smooth = aa; }
+
+    // prev가 비어 있으면 배경이 이미 지워진 것으로 보고 next만 그림
+    void draw(UICanvas *tft, const String &prev, const String &next, uint16_t fg, uint16_t bg);
+
+    // 마지막 draw에서 칠한 사각형 수 / 🆕 쓴 픽셀 수
+    uint16_t getLastRectCount() const { return lastRects; }
+    uint32_t getLastPixelCount() const { return lastPixels; }
+
+    // 🆕 그려질 수 있는 행 범위 [top, bottom)
+    int16_t getTop() const { return top; }
+    int16_t getBottom() const { return bottom; }
+
+    // 🆕 숫자 전환마다 1bpp 세그먼트 diff 대비 AA 칸 비용 (AA_BENCHMARK, 시리얼 출력)
+    static void benchmark(TFT_eSPI *parent, const GFXfont *gfx, const AAFont *aa);
+
+private:
+    struct Run {
+        int16_t x;
+        int16_t y;
+        int16_t w;
+        int16_t h;
+        bool on;
+    };
+
+    const GFXfont *font;
+    const AAFont *smooth;
+    int16_t centerX;
+    int16_t baseline;
+    int16_t top;
+    int16_t bottom;
+    uint16_t lastRects;
+    uint32_t lastPixels;
+
+    // 사각형 병합 상태
+    Run open[SEGMENT_MAX_RUNS];
+    uint8_t openCount;
+    UICanvas *out;
+    uint16_t fgColor;
+    uint16_t bgColor;
+
+    const GFXglyph *glyphFor(char c) const;
+    bool pixel(const GFXglyph *g, int16_t gx, int16_t gy) const;
+    int16_t startX(const String &text) const;
+    int16_t textWidth(const String &text) const;
+
+    void diffGlyph(int16_t penX, char from, char to);
+    void drawCells(const String &prev, const String &next);
+    void addRun(int16_t x, int16_t y, int16_t w, bool on, Run *row, uint8_t &rowCount);
+    void closeRow(Run *row, uint8_t rowCount);
+    void emit(const Run &r);
+};
+
+#endif // UI_SEGMENT_H
@@ -0,0 +1,42 @@
+// ============================================
+// TTGO Watch Dot Stamps
+// Version: 2.4 - Span-table Circles
+// ============================================
+#ifndef UI_STAMP_H
+#define UI_STAMP_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// ============================================
+// DotStamp
+//   - 작은 반지름(≤ STAMP_MAX_RADIUS)의 채운 원을 행별 반폭 테이블로 보관
+//     (TFT_eSPI fillCircle과 같은 픽셀 모양, 처음 사용할 때 한 번 계산)
+//   - fill(): 행마다 drawFastHLine 한 번 (Bresenham 계산/중복 행 없음)
+//   - stamp(): 배경색을 아는 경우 (2r+1)² 블록을 pushImage 한 번으로 씀
+//   - 눈금 점, 궤도 점, 상태 표시 점 등 어느 화면에서나 사용
+// ============================================
+class DotStamp {
+public:
+    static bool supports(int32_t r) { return r >= 0 && r <= STAMP_MAX_RADIUS; }
+
+    // 모양이 fillCircle과 같음 (투명 - 원 밖 픽셀은 건드리지 않음)
+    static void fill(TFT_eSPI *tft, int32_t x, int32_t y, int32_t r, uint32_t color);
+
+    // 원 밖은 bg로 채운 정사각형 한 번 쓰기 (RGB565 대상 전용)
+    static void stamp(TFT_eSPI *tft, int32_t x, int32_t y, int32_t r, uint16_t color, uint16_t bg);
+
+    // 행 dy(0..r)의 반폭 (해당 행에 픽셀이 없으면 -1)
+    static int8_t halfWidth(uint8_t r, uint8_t dy);
+
+    // 🆕 fillCircle 대비 속도/픽셀 일치 측정 (STAMP_BENCHMARK, 시리얼 출력)
+    static void benchmark(TFT_eSPI *parent);
+
+private:
+    static int8_t half[STAMP_MAX_RADIUS + 1][STAMP_MAX_RADIUS + 1];
+    static bool built;
+
+    static void build();
+};
+
+#endif // UI_STAMP_H
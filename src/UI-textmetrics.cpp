@@ -0,0 +1,115 @@
+// ============================================
+// TTGO Watch Text Metrics Cache Implementation
+// Version: 2.4 - Cached Datum Alignment
+// ============================================
+
+#include "UI-textmetrics.h"
+
+TextMetricsCache::TextMetricsCache() {
+    clear();
+    resetStats();
+}
+
+// ============================================
+// Lookup / Store
+// ============================================
+bool TextMetricsCache::lookup(const char *str, const void *face, uint8_t font, uint8_t size,
+                              int16_t &w, int16_t &h) {
+    size_t len = strlen(str);
+    if (len > TEXT_METRICS_MAX_LEN) return false;
+
+    uint32_t hash = hashOf(str, len, face, font, size);
+    int s = findSlot(str, len, hash, face, font, size);
+    if (s < 0) {
+        misses++;
+        return false;
+    }
+
+    hits++;
+    slots[s].lastUse = ++useClock;
+    w = slots[s].w;
+    h = slots[s].h;
+    return true;
+}
+
+void TextMetricsCache::store(const char *str, const void *face, uint8_t font, uint8_t size,
+                             int16_t w, int16_t h) {
+    size_t len = strlen(str);
+    if (len > TEXT_METRICS_MAX_LEN) return;
+
+    uint32_t hash = hashOf(str, len, face, font, size);
+    int s = findSlot(str, len, hash, face, font, size);
+    if (s < 0) s = victimSlot(hash);
+
+    Slot &slot = slots[s];
+    slot.used = true;
+    slot.font = font;
+    slot.size = size;
+    slot.len = len;
+    slot.w = w;
+    slot.h = h;
+    slot.hash = hash;
+    slot.lastUse = ++useClock;
+    slot.face = face;
+    memcpy(slot.str, str, len + 1);
+}
+
+void TextMetricsCache::clear() {
+    useClock = 0;
+    for (int i = 0; i < TEXT_METRICS_SLOTS; i++) {
+        slots[i].used = false;
+    }
+}
+
+uint8_t TextMetricsCache::getUsedSlots() const {
+    uint8_t n = 0;
+    for (int i = 0; i < TEXT_METRICS_SLOTS; i++) {
+        if (slots[i].used) n++;
+    }
+    return n;
+}
+
+void TextMetricsCache::resetStats() {
+    hits = 0;
+    misses = 0;
+    evictions = 0;
+}
+
+// ============================================
+// Internals
+// ============================================
+uint32_t TextMetricsCache::hashOf(const char *str, size_t len, const void *face, uint8_t font, uint8_t size) {
+    // FNV-1a (문자열 + 폰트 키)
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < len; i++) {
+        h = (h ^ (uint8_t)str[i]) * 16777619u;
+    }
+    h = (h ^ font) * 16777619u;
+    h = (h ^ size) * 16777619u;
+    h = (h ^ (uint32_t)(uintptr_t)face) * 16777619u;
+    return h;
+}
+
+int TextMetricsCache::findSlot(const char *str, size_t len, uint32_t hash,
+                               const void *face, uint8_t font, uint8_t size) const {
+    uint8_t base = setOf(hash);
+    for (uint8_t i = base; i < base + WAYS; i++) {
+        const Slot &s = slots[i];
+        if (s.used && s.hash == hash && s.len == len && s.font == font && s.size == size &&
+            s.face == face && memcmp(s.str, str, len) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+int TextMetricsCache::victimSlot(uint32_t hash) {
+    uint8_t base = setOf(hash);
+    int victim = base;
+    for (uint8_t i = base; i < base + WAYS; i++) {
+        if (!slots[i].used) return i;
+        if (slots[i].lastUse < slots[victim].lastUse) victim = i;
+    }
+    evictions++;
+    return victim;
+}
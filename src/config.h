@@ -60,6 +60,97 @@
 #define CENTER_X        120
 #define CENTER_Y        120
 
+// ============================================
+// Rendering Options
+// ============================================
+#define USE_SPRITE_COMPOSITOR           // 주석 처리하면 패널 직접 그리기 (기존 방식)
+
+#define COMPOSITOR_BAND_HEIGHT  24      // 밴드/DMA 중계 버퍼 높이 (px, 2개씩 사용)
+#define COMPOSITOR_SEG_WIDTH    16      // 밴드 모드 해시 세그먼트 폭 (px)
+#define COMPOSITOR_SPAN_GAP     6       // 이 간격 이하의 변경은 하나의 span으로 병합
+#define COMPOSITOR_DMA_PERCENT  25      // 변경 비율(%)이 이 이상이면 행 전체를 DMA 전송
+#define USE_PALETTE_FRAMEBUFFER         // PSRAM 없을 때 밴드 대신 4bpp 팔레트 전체 프레임 (28.8KB)
+
+#define DIRTY_MAX_RECTS         24      // 프레임당 손상 사각형 최대 개수
+#define DIRTY_MERGE_WASTE       64      // 병합 시 허용하는 추가 픽셀 수
+
+#define GLYPH_CACHE_SLOTS       24      // RGB565 글리프 타일 캐시 슬롯 수
+#define GLYPH_SLOT_PIXELS       512     // 슬롯당 최대 픽셀 (초과 글리프는 캐시 안 함)
+
+#define TEXT_METRICS_SLOTS      32      // 문자열 폭/높이 캐시 슬롯 수 (4의 배수, datum 정렬용)
+#define TEXT_METRICS_MAX_LEN    23      // 이보다 긴 문자열은 매번 측정
+
+#define SCREEN_CACHE_SLOTS      4       // 화면 스냅샷 (시계/메뉴/배터리/NTP, PSRAM 전체 모드만)
+
+#define USE_CLOCK_BACKGROUND            // 시계 고정 라벨/테두리를 처음 한 번 RLE 이미지로 → firstDraw는 행 push만
+#define BACKGROUND_MAX_RUNS     4096    // RLE (길이, 색) 쌍 최대 개수 (16KB, 넘으면 기존처럼 글리프로 그림)
+
+#define DLIST_MAX_OPS           192     // 프레임당 기록 op 수 (넘치면 나머지는 즉시 실행)
+#define DLIST_TEXT_BYTES        1024    // 프레임당 문자열 + 텍스트 상태 저장 공간
+#define USE_SPI_BATCH                   // 패널 직접 그리기: 프레임당 SPI 트랜잭션 하나 (startWrite/endWrite)
+
+#define STAMP_MAX_RADIUS        8       // 이 반지름 이하의 fillCircle은 행 테이블로 그림
+//#define STAMP_BENCHMARK               // 부팅 시 fillCircle 대비 점 그리기 속도 측정 (시리얼)
+
+#define USE_AA_DIGITS                   // 시계 숫자를 2bpp RLE 안티앨리어싱 칸으로 (4bpp 모드는 혼합색 없이)
+//#define AA_BENCHMARK                  // 부팅 시 숫자 전환마다 세그먼트 diff 대비 AA 칸 시간/픽셀 측정 (시리얼)
+
+#define USE_SPECULATIVE_RENDER          // 초 중간에 다음 초의 숫자/베젤을 PSRAM 사본에 미리 그림 (16bpp 전체 프레임 모드만)
+#define SPEC_LEAD_MS            500     // 초가 바뀐 뒤 이 시간이 지나면 예측 렌더 (BEZEL_SMOOTH면 사용 안 함)
+
+#define SCROLL_BAND_HEIGHT      8       // 스크롤 목록이 한 번에 그리는 행 수 (240 x 8 스프라이트)
+#define SCROLL_DRAG_THRESHOLD   8       // 이만큼(px) 움직이면 탭이 아닌 드래그
+
+// ============================================
+// Hangul Text (LittleFS 글리프 저장소, 메뉴/요일 한글 표시)
+// ============================================
+//#define USE_HANGUL_TEXT               // tools/glyph_store.py로 만든 파일을 LittleFS에 올린 뒤 사용 (없으면 영문)
+#define GLYPH_STORE_PATH        "/hangul.bin"
+#define GLYPH_STORE_SLOTS       32      // RAM LRU 슬롯 수 (메뉴 한 화면 + 요일이 들어가는 정도)
+#define GLYPH_STORE_MAX_BYTES   72      // 슬롯당 최대 비트맵 (24x24 1bpp, 초과 글자는 표시 안 함)
+
+// ============================================
+// Animation (프레임 수가 아닌 경과 시간 기준)
+// ============================================
+#define ORBIT_DEG_PER_SEC       72      // 궤도 점 각속도 (도/초, 5초에 한 바퀴)
+
+// ============================================
+// Analog Face (메뉴 > Watch Face, PSRAM 전체 프레임 모드 전용)
+// ============================================
+//#define ANALOG_SWEEP                  // 초침을 매 프레임 조금씩 (기본: 1초마다 한 칸)
+
+// ============================================
+// Frame Pacing (상태별 프레임 주기, ms)
+// ============================================
+#define FRAME_MS_CLOCK          20      // 시계 애니메이션 (50fps)
+#define FRAME_MS_MENU           40      // 메뉴 (터치 폴링 주기 겸함)
+#define FRAME_MS_NTP            50
+#define FRAME_MS_BATTERY        50
+
+//#define BEZEL_SMOOTH                  // 베젤을 초마다 6도 대신 1도씩 부드럽게 회전 (렌더러 부하 테스트 겸용)
+#define FRAME_MS_SMOOTH         33      // 부드러운 회전 모드의 시계 주기 (30fps 유지 목표)
+
+//#define PACER_LIGHT_SLEEP             // 유휴 시간에 light sleep (백라이트 LEDC 클럭 확인 후 사용)
+#define PACER_LIGHT_SLEEP_MIN_MS 30     // 이보다 긴 유휴 시간만 light sleep
+#define TOUCH_INT_PIN           38      // 터치 인터럽트 (대기/light sleep 깨우기)
+
+// ============================================
+// Frame Rate Governor
+// ============================================
+#define GOV_MS_DIMMED           1000    // 화면 어두워진 시계: 1fps
+#define GOV_MS_EVENT_POLL       250     // 정적 화면: 그리지 않고 터치만 확인
+#define GOV_BOOST_MS            1000    // 터치/버튼 후 이 시간 동안 최대 프레임 속도
+
+// ============================================
+// Ambient Mode (저전력 상시 표시)
+// ============================================
+#define USE_AMBIENT_MODE                // 주석 처리하면 기존 방식 (어둡게 → deep sleep)
+#define AMBIENT_TIMEOUT         AUTO_SLEEP_TIME         // 입력 없이 이 시간이 지나면 진입 (그 전 절반은 기존처럼 어둡게)
+#define AMBIENT_BRIGHTNESS      MIN_BRIGHTNESS
+#define AMBIENT_CPU_MHZ         80      // 상시 표시 중 CPU 클럭 (분당 1프레임)
+#define AMBIENT_WAKE_MARGIN_MS  20      // 분이 바뀐 직후 그리도록 더하는 여유
+#define AMBIENT_SLEEP_TIME      (10 * 60 * 1000UL)      // 상시 표시가 이만큼 이어지면 deep sleep (버튼으로 깨움)
+
 // ============================================
 // Brightness Levels
 // ============================================
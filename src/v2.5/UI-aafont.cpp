@@ -0,0 +1,110 @@
+// ============================================
+// TTGO Watch Anti-aliased Glyphs Implementation
+// Version: 2.5 - 2bpp RLE Fonts
+// ============================================
+
+#include "UI-aafont.h"
+
+
+// ============================================
+// Glyph Lookup
+// ============================================
+const AAGlyph *AAText::glyphFor(const AAFont *font, char c) {
+    uint8_t uc = (uint8_t)c;
+    if (font == nullptr || uc < font->first || uc > font->last) return nullptr;
+
+    const AAGlyph *g = &font->glyphs[uc - font->first];
+    return g->advance > 0 ? g : nullptr;
+}
+
+uint8_t AAText::advance(const AAFont *font, char c) {
+    const AAGlyph *g = glyphFor(font, c);
+    return g != nullptr ? g->advance : 0;
+}
+
+// 채널별 선형 혼합 (level / 3)
+uint16_t AAText::blend(uint16_t fg, uint16_t bg, uint8_t level) {
+    if (level == 0) return bg;
+    if (level >= 3) return fg;
+
+    int32_t r = (bg >> 11) + (((fg >> 11) - (bg >> 11)) * level) / 3;
+    int32_t g = ((bg >> 5) & 0x3F) + ((((fg >> 5) & 0x3F) - ((bg >> 5) & 0x3F)) * level) / 3;
+    int32_t b = (bg & 0x1F) + (((fg & 0x1F) - (bg & 0x1F)) * level) / 3;
+    return (r << 11) | (g << 5) | b;
+}
+
+// ============================================
+// Draw
+// ============================================
+int16_t AAText::draw(TFT_eSPI *tft, const AAFont *font, char c, int32_t x, int32_t top,
+                     uint16_t fg, uint16_t bg) {
+    const AAGlyph *g = glyphFor(font, c);
+    if (g == nullptr) return 0;
+
+    // 스프라이트 버퍼 순서 (바이트 스왑)
+    uint16_t lut[4];
+    for (uint8_t i = 0; i < 4; i++) {
+        uint16_t v = blend(fg, bg, i);
+        lut[i] = (v >> 8) | (v << 8);
+    }
+
+    int32_t w = g->advance;
+    int32_t h = font->height;
+    int32_t rowsPerBlock = AA_BLOCK_PIXELS / w;
+
+    uint16_t block[AA_BLOCK_PIXELS];
+    const uint8_t *run = font->runs + g->offset;
+    uint16_t color = 0;
+    uint8_t left = 0;
+
+    bool oldSwap = tft->getSwapBytes();
+    tft->setSwapBytes(false);
+
+    for (int32_t y = 0; y < h; y += rowsPerBlock) {
+        int32_t rows = min(rowsPerBlock, h - y);
+        uint16_t *p = block;
+        uint16_t *end = block + rows * w;
+
+        while (p < end) {
+            if (left == 0) {
+                uint8_t r = pgm_read_byte(run++);
+                color = lut[r >> 6];
+                left = (r & 0x3F) + 1;
+            }
+            uint8_t n = (uint8_t)min((int32_t)left, (int32_t)(end - p));
+            for (uint8_t i = 0; i < n; i++) *p++ = color;
+            left -= n;
+        }
+
+        tft->pushImage(x, top + y, w, rows, block);
+    }
+
+    tft->setSwapBytes(oldSwap);
+    return w;
+}
+
+// 행 끝에서 run을 나눠 drawFastHLine (fg/bg는 대상의 색 값 그대로)
+int16_t AAText::drawSolid(TFT_eSPI *tft, const AAFont *font, char c, int32_t x, int32_t top,
+                          uint32_t fg, uint32_t bg) {
+    const AAGlyph *g = glyphFor(font, c);
+    if (g == nullptr) return 0;
+
+    int32_t w = g->advance;
+    int32_t total = w * font->height;
+    const uint8_t *run = font->runs + g->offset;
+
+    for (int32_t pos = 0; pos < total; ) {
+        uint8_t r = pgm_read_byte(run++);
+        uint32_t color = (r >> 6) >= 2 ? fg : bg;
+        int32_t left = min((int32_t)(r & 0x3F) + 1, total - pos);
+
+        while (left > 0) {
+            int32_t cx = pos % w;
+            int32_t n = min(left, w - cx);
+            tft->drawFastHLine(x + cx, top + pos / w, n, color);
+            pos += n;
+            left -= n;
+        }
+    }
+    return w;
+}
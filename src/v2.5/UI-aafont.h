@@ -0,0 +1,55 @@
+// ============================================
+// TTGO Watch Anti-aliased Glyphs
+// Version: 2.5 - 2bpp RLE Fonts
+// ============================================
+#ifndef UI_AAFONT_H
+#define UI_AAFONT_H
+
+#include <Arduino.h>
+#include "config.h"
+
+#define AA_BLOCK_PIXELS     512     // 한 번에 pushImage하는 픽셀 수 (스택 1KB)
+
+// ============================================
+// 2bpp RLE 글리프 (tools/font_subset.py가 fonts.h에 생성)
+//   - 글리프 = xAdvance x height 칸 전체 (배경 포함 → 그리면 칸이 지워짐)
+//   - run 바이트 = (레벨 << 6) | (길이 - 1), 레벨 0 = 배경 .. 3 = 글자색
+//   - run은 행 끝을 넘어 다음 행으로 이어짐
+// ============================================
+struct AAGlyph {
+    uint16_t offset;    // runs 안의 시작 위치
+    uint8_t advance;    // 칸 폭 (GFX xAdvance와 같음), 0 = 글리프 없음
+};
+
+struct AAFont {
+    const uint8_t *runs;
+    const AAGlyph *glyphs;
+    uint8_t first;
+    uint8_t last;
+    uint8_t ascent;     // 칸 위쪽 = 기준선 - ascent
+    uint8_t height;     // 칸 높이 (ascent + descent)
+};
+
+// ============================================
+// AAText
+//   - draw(): 레벨 4개를 fg/bg 혼합 RGB565로 미리 만들고
+//     run을 풀면서 블록 버퍼에 채워 pushImage (스프라이트 = 행 복사, 패널 = 창 1개 스트림)
+//   - drawSolid(): 4bpp 팔레트 대상 - 혼합색 없이 레벨 2 이상만 글자색 (팔레트 슬롯 절약)
+// ============================================
+class AAText {
+public:
+    // 칸 폭 (글리프가 없으면 0)
+    static uint8_t advance(const AAFont *font, char c);
+
+    // (x, top) = 칸 왼쪽 위, 그린 폭 반환
+    static int16_t draw(TFT_eSPI *tft, const AAFont *font, char c, int32_t x, int32_t top,
+                        uint16_t fg, uint16_t bg);
+    static int16_t drawSolid(TFT_eSPI *tft, const AAFont *font, char c, int32_t x, int32_t top,
+                             uint32_t fg, uint32_t bg);
+
+private:
+    static const AAGlyph *glyphFor(const AAFont *font, char c);
+    static uint16_t blend(uint16_t fg, uint16_t bg, uint8_t level);
+};
+
+#endif // UI_AAFONT_H
@@ -0,0 +1,46 @@
+// ============================================
+// TTGO Watch Ambient Display
+// Version: 2.5 - Always-on Ambient Mode
+// ============================================
+#ifndef UI_AMBIENT_H
+#define UI_AMBIENT_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// ============================================
+// AmbientDisplay
+//   - ST7789 idle 모드 (8색) + partial 모드 (지정한 행 띠만 표시, 나머지는 꺼짐)
+//   - 명령만 보냄: 띠 안의 내용은 평소처럼 GRAM에 그림
+//   - 논리 좌표 → 게이트 라인 변환은 회전 0/2만 지원 (그 외엔 idle 모드만)
+// ============================================
+class AmbientDisplay {
+public:
+    AmbientDisplay();
+
+    void begin(TFT_eSPI *panel, uint8_t rotation);
+
+    // 논리 행 [y0, y1)만 표시 (호출 전 DMA/SPI 트랜잭션이 끝나 있어야 함)
+    void enter(int16_t y0, int16_t y1);
+    void exit();
+
+    bool isActive() const { return active; }
+
+    // 통계
+    uint32_t getEntries() const { return entries; }
+    uint32_t getLastDurationSec() const { return lastDurationSec; }
+
+private:
+    TFT_eSPI *tft;
+    uint8_t rotation;
+    bool active;
+    bool partial;
+
+    uint32_t entries;
+    uint32_t lastDurationSec;
+    unsigned long enteredAt;
+
+    bool gateLines(int16_t y0, int16_t y1, uint16_t &start, uint16_t &end) const;
+};
+
+#endif // UI_AMBIENT_H
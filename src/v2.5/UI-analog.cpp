@@ -0,0 +1,247 @@
+// ============================================
+// TTGO Watch Analog Face Implementation
+// Version: 2.5 - Analog Gauge Face
+// ============================================
+
+#include "UI-analog.h"
+
+static const size_t frameBytes = SCREEN_WIDTH * SCREEN_HEIGHT * sizeof(uint16_t);
+
+// 바늘 모양: 폭, 중심에서 끝까지 길이, 중심 뒤로 나오는 꼬리
+static const int16_t handWidth[ANALOG_HANDS]  = { 7, 5, 2 };
+static const int16_t handLength[ANALOG_HANDS] = { 58, 88, 100 };
+static const int16_t handTail[ANALOG_HANDS]   = { 10, 12, 20 };
+static const uint16_t handColor[ANALOG_HANDS] = { COLOR_WHITE, COLOR_GRAY1, COLOR_RED };
+
+#define HAND_KEY    TFT_BLACK   // 바늘 스프라이트의 투명색 (바늘에는 검정 없음)
+
+// ============================================
+// Constructor / Destructor
+// ============================================
+AnalogFace::AnalogFace() {
+    for (uint8_t i = 0; i < ANALOG_HANDS; i++) {
+        hands[i].sprite = nullptr;
+        hands[i].pivotX = 0;
+        hands[i].pivotY = 0;
+        hands[i].angle = 0;
+        hands[i].box = { 0, 0, 0, 0 };
+        hands[i].drawn = false;
+    }
+    background = nullptr;
+    dialCaptured = false;
+    lastRestored = 0;
+    lastHands = 0;
+}
+
+AnalogFace::~AnalogFace() {
+    for (uint8_t i = 0; i < ANALOG_HANDS; i++) {
+        if (hands[i].sprite != nullptr) {
+            hands[i].sprite->deleteSprite();
+            delete hands[i].sprite;
+        }
+    }
+    free(background);
+}
+
+bool AnalogFace::begin(TFT_eSPI *panel) {
+    if (background != nullptr) return true;
+    if (!psramFound()) {
+        _PL("Analog face: disabled (needs PSRAM)");
+        return false;
+    }
+
+    for (uint8_t i = 0; i < ANALOG_HANDS; i++) {
+        if (!buildHand(hands[i], panel, handWidth[i], handLength[i], handTail[i], handColor[i])) {
+            _PL("Analog face: hand sprite allocation failed");
+            return false;
+        }
+    }
+
+    // 배경 112.5KB - 눈금판은 첫 repaint 때 프레임에 그린 뒤 복사
+    background = (uint16_t *)ps_malloc(frameBytes);
+    if (background == nullptr) {
+        _PL("Analog face: background allocation failed");
+        return false;
+    }
+    _PL("Analog face: ready");
+    return true;
+}
+
+// 12시 방향을 향한 바늘 (회전 중심 = 스프라이트의 (w/2, length))
+bool AnalogFace::buildHand(Hand &h, TFT_eSPI *panel, int16_t width, int16_t length, int16_t tail, uint16_t color) {
+    h.sprite = new TFT_eSprite(panel);
+    h.sprite->setColorDepth(16);
+    if (h.sprite->createSprite(width, length + tail) == nullptr) {
+        delete h.sprite;
+        h.sprite = nullptr;
+        return false;
+    }
+
+    h.sprite->fillSprite(HAND_KEY);
+    int16_t tip = min((int16_t)(width * 2), length);
+    h.sprite->fillRect(0, tip, width, length + tail - tip, color);
+    h.sprite->fillTriangle(0, tip, width - 1, tip, width / 2, 0, color);
+
+    h.pivotX = width / 2;
+    h.pivotY = length;
+    h.sprite->setPivot(h.pivotX, h.pivotY);
+    return true;
+}
+
+// ============================================
+// Dial (한 번만 그림)
+// ============================================
+void AnalogFace::renderDial(TFT_eSprite *frame) {
+    frame->fillSprite(COLOR_BLACK);
+    frame->drawCircle(CENTER_X, CENTER_Y, 118, COLOR_GRAY1);
+
+    for (int i = 0; i < 60; i++) {
+        float a = i * 6 * DEG_TO_RAD;
+        float s = sin(a);
+        float c = cos(a);
+        bool hour = i % 5 == 0;
+        int16_t inner = hour ? 100 : 108;
+
+        frame->drawLine(CENTER_X + s * inner, CENTER_Y - c * inner,
+                        CENTER_X + s * 114, CENTER_Y - c * 114,
+                        hour ? COLOR_WHITE : COLOR_GRAY2);
+        if (hour) {
+            frame->drawLine(CENTER_X + s * inner + c, CENTER_Y - c * inner + s,
+                            CENTER_X + s * 114 + c, CENTER_Y - c * 114 + s, COLOR_WHITE);
+        }
+    }
+
+    frame->setTextDatum(MC_DATUM);
+    frame->setTextColor(COLOR_WHITE, COLOR_BLACK);
+    frame->drawString("12", CENTER_X, CENTER_Y - 82, 4);
+    frame->drawString("3", CENTER_X + 84, CENTER_Y, 4);
+    frame->drawString("6", CENTER_X, CENTER_Y + 82, 4);
+    frame->drawString("9", CENTER_X - 84, CENTER_Y, 4);
+
+    frame->setTextColor(COLOR_CYAN, COLOR_BLACK);
+    frame->drawString("GAUGE", CENTER_X, CENTER_Y + 40, 2);
+}
+
+// ============================================
+// Draw
+// ============================================
+void AnalogFace::draw(TFT_eSprite *frame, DirtyRegion *damage,
+                      int hour, int minute, int second, uint16_t secondMs, bool repaint) {
+    lastRestored = 0;
+    lastHands = 0;
+    if (!isReady() || frame == nullptr) return;
+
+    uint16_t *fb = (uint16_t *)frame->getPointer();
+    if (fb == nullptr) return;
+
+#ifdef ANALOG_SWEEP
+    int16_t secAngle = (second * 1000 + secondMs) * 6 / 1000;
+#else
+    (void)secondMs;
+    int16_t secAngle = second * 6;
+#endif
+    int16_t angles[ANALOG_HANDS] = {
+        (int16_t)((hour % 12) * 30 + minute / 2),
+        (int16_t)(minute * 6 + second / 10),
+        secAngle
+    };
+
+    if (repaint) {
+        if (!dialCaptured) {
+            renderDial(frame);
+            memcpy(background, fb, frameBytes);
+            dialCaptured = true;
+        } else {
+            memcpy(fb, background, frameBytes);
+        }
+        damage->addAll();
+        lastRestored = SCREEN_WIDTH * SCREEN_HEIGHT;
+        for (uint8_t i = 0; i < ANALOG_HANDS; i++) hands[i].drawn = false;
+    }
+
+    // 1. 움직인 바늘: 이전/새 경계 사각형을 배경으로 복원할 영역에 추가
+    DirtyRect clear[ANALOG_HANDS * 2];
+    uint8_t clearCount = 0;
+    bool redraw[ANALOG_HANDS];
+    for (uint8_t i = 0; i < ANALOG_HANDS; i++) {
+        Hand &h = hands[i];
+        redraw[i] = !h.drawn || h.angle != angles[i];
+        if (!redraw[i]) continue;
+
+        if (h.drawn) clear[clearCount++] = h.box;
+        h.angle = angles[i];
+        h.box = boundsFor(h, h.angle);
+        h.drawn = true;
+        clear[clearCount++] = h.box;
+    }
+    if (clearCount == 0) return;
+
+    // 2. 복원 영역에 걸친 바늘, 다시 그리는 바늘 위에 놓인 바늘도 다시 그림
+    bool grown = true;
+    while (grown) {
+        grown = false;
+        for (uint8_t i = 0; i < ANALOG_HANDS; i++) {
+            if (redraw[i]) continue;
+            for (uint8_t c = 0; c < clearCount && !redraw[i]; c++) {
+                redraw[i] = hands[i].box.overlaps(clear[c]);
+            }
+            for (uint8_t j = 0; j < i && !redraw[i]; j++) {
+                redraw[i] = redraw[j] && hands[i].box.overlaps(hands[j].box);
+            }
+            grown |= redraw[i];
+        }
+    }
+
+    // 3. 배경 복원 (repaint면 이미 전체 복원됨)
+    if (!repaint) {
+        for (uint8_t c = 0; c < clearCount; c++) {
+            restore(fb, clear[c]);
+            damage->add(clear[c].x, clear[c].y, clear[c].w, clear[c].h);
+        }
+    }
+
+    // 4. 바늘 합성 (z 순서) + 중심 캡
+    frame->setPivot(CENTER_X, CENTER_Y);
+    for (uint8_t i = 0; i < ANALOG_HANDS; i++) {
+        if (!redraw[i]) continue;
+        hands[i].sprite->pushRotated(frame, hands[i].angle, HAND_KEY);
+        damage->add(hands[i].box.x, hands[i].box.y, hands[i].box.w, hands[i].box.h);
+        lastHands++;
+    }
+    DotStamp::fill(frame, CENTER_X, CENTER_Y, 4, COLOR_ORANGE);
+}
+
+// 스프라이트 네 모서리를 회전 중심 기준으로 돌려 경계 계산 (시계 방향, y 아래로)
+DirtyRect AnalogFace::boundsFor(const Hand &h, int16_t angle) const {
+    float a = angle * DEG_TO_RAD;
+    float s = sin(a);
+    float c = cos(a);
+    int16_t w = h.sprite->width();
+    int16_t hh = h.sprite->height();
+    const int16_t xs[4] = { (int16_t)-h.pivotX, (int16_t)(w - h.pivotX), (int16_t)-h.pivotX, (int16_t)(w - h.pivotX) };
+    const int16_t ys[4] = { (int16_t)-h.pivotY, (int16_t)-h.pivotY, (int16_t)(hh - h.pivotY), (int16_t)(hh - h.pivotY) };
+
+    float x0 = 1e6, y0 = 1e6, x1 = -1e6, y1 = -1e6;
+    for (uint8_t k = 0; k < 4; k++) {
+        float rx = xs[k] * c - ys[k] * s;
+        float ry = xs[k] * s + ys[k] * c;
+        x0 = min(x0, rx);
+        y0 = min(y0, ry);
+        x1 = max(x1, rx);
+        y1 = max(y1, ry);
+    }
+
+    int16_t left = max(0, (int)floor(CENTER_X + x0) - ANALOG_BOX_MARGIN);
+    int16_t top = max(0, (int)floor(CENTER_Y + y0) - ANALOG_BOX_MARGIN);
+    int16_t right = min(SCREEN_WIDTH, (int)ceil(CENTER_X + x1) + ANALOG_BOX_MARGIN + 1);
+    int16_t bottom = min(SCREEN_HEIGHT, (int)ceil(CENTER_Y + y1) + ANALOG_BOX_MARGIN + 1);
+    return { left, top, (int16_t)(right - left), (int16_t)(bottom - top) };
+}
+
+void AnalogFace::restore(uint16_t *fb, const DirtyRect &r) {
+    for (int16_t y = r.y; y < r.bottom(); y++) {
+        size_t at = (size_t)y * SCREEN_WIDTH + r.x;
+        memcpy(fb + at, background + at, r.w * sizeof(uint16_t));
+    }
+    lastRestored += r.area();
+}
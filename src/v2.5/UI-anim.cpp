@@ -0,0 +1,63 @@
+// ============================================
+// TTGO Watch Animation Clock Implementation
+// Version: 2.5 - Time-based Animation
+// ============================================
+
+#include "UI-anim.h"
+
+// ============================================
+// AnimationClock
+// ============================================
+AnimationClock::AnimationClock() {
+    frameUs = 0;
+    deltaUs = 0;
+    frames = 0;
+}
+
+void AnimationClock::tick() {
+    int64_t t = micros64();
+    deltaUs = frames > 0 ? t - frameUs : 0;
+    frameUs = t;
+    frames++;
+}
+
+// ============================================
+// AngleAnimation
+// ============================================
+AngleAnimation::AngleAnimation() {
+    clock = nullptr;
+    startUs = 0;
+    startDeg = 0;
+    speed = 0;
+}
+
+void AngleAnimation::begin(const AnimationClock *c, float deg, float degPerSec) {
+    clock = c;
+    startUs = AnimationClock::micros64();
+    startDeg = deg;
+    speed = degPerSec;
+}
+
+// 현재 각도를 새 기준점으로 잡고 속도만 바꿈 (점프 없음)
+void AngleAnimation::setSpeed(float degPerSec) {
+    startDeg = angleExact();
+    startUs = clock != nullptr ? max(clock->now(), startUs) : AnimationClock::micros64();
+    speed = degPerSec;
+}
+
+float AngleAnimation::angleExact() const {
+    if (clock == nullptr) return startDeg;
+
+    // begin() 이후 아직 tick()이 없었으면 경과 0
+    int64_t elapsed = clock->now() - startUs;
+    if (elapsed < 0) elapsed = 0;
+
+    double deg = fmod(startDeg + (double)speed * elapsed / 1000000.0, 360.0);
+    if (deg < 0) deg += 360.0;
+    return (float)deg;
+}
+
+int AngleAnimation::angle() const {
+    int a = (int)lroundf(angleExact());
+    return a >= 360 ? a - 360 : a;
+}
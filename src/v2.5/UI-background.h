@@ -0,0 +1,54 @@
+// ============================================
+// TTGO Watch Static Background Image
+// Version: 2.5 - RLE Clock Background
+// ============================================
+#ifndef UI_BACKGROUND_H
+#define UI_BACKGROUND_H
+
+#include <Arduino.h>
+#include <functional>
+#include "config.h"
+#include "UI-canvas.h"
+
+// ============================================
+// BackgroundImage
+//   - 화면의 고정 요소(라벨/테두리/아이콘)를 처음 한 번만 그려 RLE로 저장
+//   - 이후 firstDraw는 글리프를 다시 그리지 않고 행 단위 push 한 번 (fillScreen 포함)
+//   - 저장 형식: (길이, 색) uint16_t 쌍, 행마다 끊김, 색은 스프라이트 버퍼 순서
+//   - 작은 띠 스프라이트에 나눠 그려 부호화 → 전체 프레임 버퍼 없이도 생성
+//   - PSRAM 있으면 PSRAM, 없으면 힙 (BACKGROUND_MAX_RUNS 초과면 포기)
+//   - tag: 이미지가 유효한 조건 (예: NTP 아이콘 색), 다르면 다시 생성
+// ============================================
+class BackgroundImage {
+public:
+    // 배경은 이미 bg 색으로 지워져 있음 → 고정 요소만 그림
+    typedef std::function<void(UICanvas *tft)> PaintFn;
+
+    BackgroundImage();
+    ~BackgroundImage();
+
+    bool build(TFT_eSPI *panel, const PaintFn &paint, uint16_t bg, uint32_t tag = 0);
+    void end();
+    bool isReady() const { return runs != nullptr; }
+    bool matches(uint32_t tag) const { return isReady() && tag == builtTag; }
+
+    // 화면 전체를 씀 (기록 모드에서는 op 하나)
+    void draw(UICanvas *tft) const;
+
+    // 통계
+    uint32_t getRuns() const { return runCount; }
+    uint32_t getBytes() const { return runCount * 2 * sizeof(uint16_t); }
+    uint32_t getLastBuildUs() const { return lastBuildUs; }
+
+private:
+    uint16_t *runs;
+    uint32_t runCount;
+    uint32_t builtTag;
+    uint32_t lastBuildUs;
+
+    // out == nullptr: 개수만 셈
+    uint32_t renderPass(TFT_eSprite *strip, const PaintFn &paint, uint16_t bg, uint16_t *out);
+    static uint32_t encodeRows(const uint16_t *pixels, int16_t rows, uint16_t *out);
+};
+
+#endif // UI_BACKGROUND_H
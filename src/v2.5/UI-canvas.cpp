@@ -0,0 +1,556 @@
+// ============================================
+// TTGO Watch Drawing Canvas Implementation
+// Version: 2.5 - Damage Tracking
+// ============================================
+
+#include "UI-canvas.h"
+#include "UI-glyphstore.h"
+
+// 글리프 최대 글자 수 (슬롯보다 적어야 모으는 도중 교체되지 않음)
+#define BLIT_MAX_CHARS  (GLYPH_CACHE_SLOTS / 2)
+
+UICanvas::UICanvas() : UICanvas(nullptr, nullptr) {
+}
+
+UICanvas::UICanvas(TFT_eSPI *target, DirtyRegion *damage) {
+    dirty = damage;
+    glyphs = nullptr;
+    metrics = nullptr;
+    palette = nullptr;
+    text = { nullptr, TFT_WHITE, TFT_WHITE, TL_DATUM, 1, 1 };
+
+    lists = nullptr;
+    cur = 0;
+    recording = false;
+    prevValid = false;
+    submitted = 0;
+    executed = 0;
+    lastRecorded = 0;
+    lastEmitted = 0;
+
+    batching = false;
+    inBatch = false;
+    batchTx = 0;
+    savedTx = 0;
+    mergedFills = 0;
+
+    setTarget(target);
+}
+
+UICanvas::~UICanvas() {
+    delete[] lists;
+}
+
+// 대상이 바뀌면 추적 중인 텍스트 상태를 대상에 다시 적용
+void UICanvas::setTarget(TFT_eSPI *target) {
+    tft = target;
+    prevValid = false;
+    if (tft != nullptr) applyTextState();
+}
+
+void UICanvas::applyTextState() {
+    tft->setTextDatum(text.datum);
+    tft->setTextSize(text.size);
+    tft->setTextColor(ink(text.fg), ink(text.bg));
+    if (text.gfx != nullptr) {
+        tft->setFreeFont(text.gfx);
+    } else {
+        tft->setTextFont(text.font);
+    }
+}
+
+// ============================================
+// Text State
+// ============================================
+void UICanvas::setTextDatum(uint8_t d) {
+    text.datum = d;
+    tft->setTextDatum(d);
+}
+
+// 배경 없는 색 지정은 fg == bg 와 같음 (TFT_eSPI 동일)
+void UICanvas::setTextColor(uint16_t fg) {
+    text.fg = fg;
+    text.bg = fg;
+    tft->setTextColor(ink(fg));
+}
+
+void UICanvas::setTextColor(uint16_t fg, uint16_t bg) {
+    text.fg = fg;
+    text.bg = bg;
+    tft->setTextColor(ink(fg), ink(bg));
+}
+
+void UICanvas::setTextFont(uint8_t font) {
+    text.font = font > 0 ? font : 1;
+    text.gfx = nullptr;
+    tft->setTextFont(font);
+}
+
+void UICanvas::setFreeFont(const GFXfont *font) {
+    text.gfx = font;
+    if (font == nullptr) text.font = 1;
+    tft->setFreeFont(font);
+}
+
+void UICanvas::setTextSize(uint8_t size) {
+    text.size = size > 0 ? size : 1;
+    tft->setTextSize(size);
+}
+
+// ============================================
+// Shapes
+// ============================================
+void UICanvas::fillScreen(uint32_t color) {
+    submit(DrawOp::FILL_SCREEN, color, 0, 0);
+}
+
+void UICanvas::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+    submit(DrawOp::FILL_RECT, color, x, y, w, h);
+}
+
+void UICanvas::drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+    submit(DrawOp::DRAW_RECT, color, x, y, w, h);
+}
+
+void UICanvas::drawCircle(int32_t x, int32_t y, int32_t r, uint32_t color) {
+    submit(DrawOp::DRAW_CIRCLE, color, x, y, r);
+}
+
+void UICanvas::fillCircle(int32_t x, int32_t y, int32_t r, uint32_t color) {
+    submit(DrawOp::FILL_CIRCLE, color, x, y, r);
+}
+
+void UICanvas::stampDot(int32_t x, int32_t y, int32_t r, uint16_t color, uint16_t bg) {
+    submit(DrawOp::STAMP_DOT, color, x, y, r, (int16_t)bg);
+}
+
+void UICanvas::drawAAGlyph(const AAFont *font, char c, int32_t x, int32_t top, uint16_t fg, uint16_t bg) {
+    uint8_t w = AAText::advance(font, c);
+    if (w == 0) return;
+    submit(DrawOp::AA_GLYPH, fg, x, top, w, font->height, (int16_t)bg, (uint8_t)c,
+           (const uint16_t *)font);
+}
+
+void UICanvas::drawStoreGlyph(GlyphStore *store, uint16_t cp, uint8_t w, int32_t x, int32_t top,
+                              uint16_t fg, uint16_t bg) {
+    if (w == 0) return;
+    submit(DrawOp::STORE_GLYPH, fg, x, top, w, store->getHeight(), (int16_t)bg, (int16_t)cp,
+           (const uint16_t *)store);
+}
+
+void UICanvas::drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color) {
+    submit(DrawOp::DRAW_LINE, color, x0, y0, x1, y1);
+}
+
+void UICanvas::fillTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1,
+                            int32_t x2, int32_t y2, uint32_t color) {
+    submit(DrawOp::FILL_TRIANGLE, color, x0, y0, x1, y1, x2, y2);
+}
+
+void UICanvas::pushRaw(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data) {
+    submit(DrawOp::PUSH_RAW, 0, x, y, w, h, 0, 0, data);
+}
+
+void UICanvas::pushRuns(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *runs) {
+    if (w > SCREEN_WIDTH) return;
+    submit(DrawOp::PUSH_RUNS, 0, x, y, w, h, 0, 0, runs);
+}
+
+// ============================================
+// Text
+// ============================================
+int16_t UICanvas::drawString(const char *str, int32_t x, int32_t y) {
+    return submitText(str, x, y, 0);
+}
+
+int16_t UICanvas::drawString(const char *str, int32_t x, int32_t y, uint8_t font) {
+    return submitText(str, x, y, font);
+}
+
+// ============================================
+// 🆕 Display List
+// ============================================
+void UICanvas::beginList() {
+    if (lists == nullptr) {
+        lists = new DisplayList[2];
+        prevValid = false;
+    }
+    lists[cur].clear();
+    recording = true;
+    submitted = 0;
+    executed = 0;
+}
+
+void UICanvas::endList() {
+    if (recording) {
+        const DisplayList &list = lists[cur];
+        bool emit[DLIST_MAX_OPS];
+
+        if (prevValid) {
+            list.diff(lists[cur ^ 1], emit);
+        } else {
+            for (uint16_t i = 0; i < list.size(); i++) emit[i] = true;
+        }
+
+        emitList(list, emit);
+
+        // 이번 목록이 곧 대상의 내용 → 다음 프레임의 비교 기준
+        cur ^= 1;
+        prevValid = true;
+        recording = false;
+    }
+
+    lastRecorded = submitted;
+    lastEmitted = executed;
+}
+
+void UICanvas::resetList() {
+    prevValid = false;
+}
+
+// 기록 중이면 목록에 추가, 아니면 즉시 실행 (대상이 바뀌었으므로 이전 목록은 무효)
+void UICanvas::submit(DrawOp op, uint16_t color, int16_t p0, int16_t p1, int16_t p2,
+                      int16_t p3, int16_t p4, int16_t p5, const uint16_t *data) {
+    DisplayOp o = { op, 0, color, { p0, p1, p2, p3, p4, p5 }, 0, 0, data };
+    submitted++;
+
+    if (recording) {
+        if (lists[cur].add(o)) return;
+        flushRecorded();
+    }
+    prevValid = false;
+    executeShape(o);
+}
+
+int16_t UICanvas::submitText(const char *str, int32_t x, int32_t y, uint8_t font) {
+    submitted++;
+
+    if (recording) {
+        int16_t w, h;
+        measure(str, font, w, h);
+        DirtyRect r = textBounds(w, h, x, y);
+
+        DisplayOp o = { DrawOp::TEXT, font, 0, { (int16_t)x, (int16_t)y, r.x, r.y, r.w, r.h }, 0, 0, nullptr };
+        if (lists[cur].addText(o, text, str)) return w;
+        flushRecorded();
+    }
+    prevValid = false;
+    return executeText(text, str, x, y, font);
+}
+
+// 🆕 같은 색, 같은 폭(높이)으로 맞닿은 두 fillRect → 하나로 (창 설정 + 트랜잭션 1회)
+static bool mergeFill(DisplayOp &into, const DisplayOp &next) {
+    if (next.op != DrawOp::FILL_RECT || next.color != into.color) return false;
+
+    int16_t *a = into.p;
+    const int16_t *b = next.p;
+    if (a[0] == b[0] && a[2] == b[2]) {
+        if (b[1] == a[1] + a[3]) { a[3] += b[3]; return true; }
+        if (b[1] + b[3] == a[1]) { a[1] = b[1]; a[3] += b[3]; return true; }
+    }
+    if (a[1] == b[1] && a[3] == b[3]) {
+        if (b[0] == a[0] + a[2]) { a[2] += b[2]; return true; }
+        if (b[0] + b[2] == a[0]) { a[0] = b[0]; a[2] += b[2]; return true; }
+    }
+    return false;
+}
+
+// 실행할 op를 순서대로 (연속한 fillRect는 합쳐서) 대상에 그림
+void UICanvas::emitList(const DisplayList &list, const bool *emit) {
+    inBatch = batching && tft != nullptr;
+    if (inBatch) {
+        tft->startWrite();   // 이후 primitive는 CS/트랜잭션을 다시 열지 않음
+        batchTx = 0;
+    }
+
+    DisplayOp fill;
+    bool pending = false;
+    for (uint16_t i = 0; i < list.size(); i++) {
+        if (!emit[i]) continue;
+        const DisplayOp &op = list.at(i);
+
+        if (pending) {
+            if (mergeFill(fill, op)) {
+                mergedFills++;
+                continue;
+            }
+            executeShape(fill);
+            pending = false;
+        }
+        if (op.op == DrawOp::FILL_RECT) {
+            fill = op;
+            pending = true;
+        } else {
+            execute(list, op);
+        }
+    }
+    if (pending) {
+        executeShape(fill);
+    }
+
+    if (inBatch) {
+        tft->endWrite();
+        if (batchTx > 1) savedTx += batchTx - 1;
+        inBatch = false;
+    }
+}
+
+// 목록이 가득 참: 지금까지 기록한 op를 모두 실행하고 이 프레임의 나머지는 즉시 실행
+void UICanvas::flushRecorded() {
+    const DisplayList &list = lists[cur];
+    for (uint16_t i = 0; i < list.size(); i++) {
+        execute(list, list.at(i));
+    }
+    recording = false;
+    prevValid = false;
+}
+
+// ============================================
+// Execute
+// ============================================
+void UICanvas::execute(const DisplayList &list, const DisplayOp &op) {
+    if (op.op == DrawOp::TEXT) {
+        executeText(list.stateOf(op), list.stringOf(op), op.p[0], op.p[1], op.font);
+    } else {
+        executeShape(op);
+    }
+}
+
+void UICanvas::executeShape(const DisplayOp &op) {
+    const int16_t *p = op.p;
+    uint32_t c = ink(op.color);
+    executed++;
+    countTx(1);
+
+    switch (op.op) {
+        case DrawOp::FILL_SCREEN:
+            tft->fillScreen(c);
+            if (dirty != nullptr) dirty->addAll();
+            return;
+        case DrawOp::FILL_RECT:     tft->fillRect(p[0], p[1], p[2], p[3], c); break;
+        case DrawOp::DRAW_RECT:     tft->drawRect(p[0], p[1], p[2], p[3], c); break;
+        case DrawOp::DRAW_CIRCLE:   tft->drawCircle(p[0], p[1], p[2], c); break;
+        case DrawOp::FILL_CIRCLE:
+            if (DotStamp::supports(p[2])) {
+                DotStamp::fill(tft, p[0], p[1], p[2], c);
+            } else {
+                tft->fillCircle(p[0], p[1], p[2], c);
+            }
+            break;
+        case DrawOp::STAMP_DOT:
+            if (palette == nullptr && DotStamp::supports(p[2])) {
+                DotStamp::stamp(tft, p[0], p[1], p[2], op.color, (uint16_t)p[3]);
+            } else {
+                tft->fillRect(p[0] - p[2], p[1] - p[2], 2 * p[2] + 1, 2 * p[2] + 1, ink((uint16_t)p[3]));
+                tft->fillCircle(p[0], p[1], p[2], c);
+            }
+            break;
+        case DrawOp::AA_GLYPH: {
+            const AAFont *font = (const AAFont *)op.data;
+            if (palette == nullptr) {
+                AAText::draw(tft, font, (char)p[5], p[0], p[1], op.color, (uint16_t)p[4]);
+            } else {
+                AAText::drawSolid(tft, font, (char)p[5], p[0], p[1], c, ink((uint16_t)p[4]));
+            }
+            break;
+        }
+        case DrawOp::STORE_GLYPH: {
+            GlyphStore *store = (GlyphStore *)op.data;
+            if (palette == nullptr) {
+                store->draw(tft, (uint16_t)p[5], p[0], p[1], op.color, (uint16_t)p[4]);
+            } else {
+                store->drawSolid(tft, (uint16_t)p[5], p[0], p[1], c, ink((uint16_t)p[4]));
+            }
+            break;
+        }
+        case DrawOp::DRAW_LINE:     tft->drawLine(p[0], p[1], p[2], p[3], c); break;
+        case DrawOp::FILL_TRIANGLE: tft->fillTriangle(p[0], p[1], p[2], p[3], p[4], p[5], c); break;
+        case DrawOp::PUSH_RAW:      rawPixels(p[0], p[1], p[2], p[3], op.data); return;
+        case DrawOp::PUSH_RUNS:     rawRuns(p[0], p[1], p[2], p[3], op.data); return;
+        case DrawOp::TEXT:          return;
+    }
+
+    DirtyRect r = op.bounds();
+    mark(r.x, r.y, r.w, r.h);
+}
+
+// 기록 당시의 텍스트 상태로 그린 뒤 현재 상태 복원
+int16_t UICanvas::executeText(const TextState &state, const char *str, int32_t x, int32_t y, uint8_t font) {
+    TextState saved = text;
+    bool swap = !(state == text);
+    if (swap) {
+        text = state;
+        applyTextState();
+    }
+    executed++;
+
+    int16_t width;
+    if (font == 0) {
+        if (text.gfx != nullptr || !blitString(str, x, y, text.font, width)) {
+            width = drawMeasured(str, x, y, 0);
+        }
+    } else if (!blitString(str, x, y, font, width)) {
+        width = drawMeasured(str, x, y, font);
+    }
+
+    if (swap) {
+        text = saved;
+        applyTextState();
+    }
+    return width;
+}
+
+void UICanvas::rawPixels(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data) {
+    if (palette != nullptr) {
+        // 4bpp 대상: 픽셀마다 인덱스로 변환 (베젤 라벨 타일 정도의 크기만 사용)
+        for (int32_t j = 0; j < h; j++) {
+            for (int32_t i = 0; i < w; i++) {
+                uint16_t c = data[j * w + i];
+                tft->drawPixel(x + i, y + j, palette->indexOf((c >> 8) | (c << 8)));
+            }
+        }
+        mark(x, y, w, h);
+        return;
+    }
+
+    bool oldSwap = tft->getSwapBytes();
+    tft->setSwapBytes(false);
+    countTx(1);
+    tft->pushImage(x, y, w, h, data);
+    tft->setSwapBytes(oldSwap);
+    mark(x, y, w, h);
+}
+
+// 🆕 RLE 행을 한 줄 버퍼에 풀어서 push (전체를 쓰므로 fillScreen 불필요)
+void UICanvas::rawRuns(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *runs) {
+    if (palette != nullptr) {
+        // 4bpp 대상: run마다 인덱스 색 가로선
+        for (int32_t j = 0; j < h; j++) {
+            for (int32_t i = 0; i < w; runs += 2) {
+                uint16_t c = runs[1];
+                tft->drawFastHLine(x + i, y + j, runs[0], palette->indexOf((c >> 8) | (c << 8)));
+                i += runs[0];
+            }
+        }
+        mark(x, y, w, h);
+        return;
+    }
+
+    uint16_t line[SCREEN_WIDTH];
+    bool oldSwap = tft->getSwapBytes();
+    tft->setSwapBytes(false);
+    for (int32_t j = 0; j < h; j++) {
+        for (int32_t i = 0; i < w; runs += 2) {
+            for (uint16_t n = 0; n < runs[0]; n++) line[i + n] = runs[1];
+            i += runs[0];
+        }
+        tft->pushImage(x, y + j, w, 1, line);
+    }
+    countTx(h - 1);
+    tft->setSwapBytes(oldSwap);
+    mark(x, y, w, h);
+}
+
+// 🆕 캐시된 글리프 타일을 이어 붙여 출력 (하나라도 없으면 false → drawString)
+bool UICanvas::blitString(const char *str, int32_t x, int32_t y, uint8_t font, int16_t &width) {
+    if (glyphs == nullptr || !glyphs->isReady()) return false;
+    if (palette != nullptr) return false;   // 타일은 RGB565 → 4bpp에선 일반 drawString
+    if (!GlyphCache::supports(font, text.fg, text.bg)) return false;
+
+    size_t len = strlen(str);
+    if (len == 0 || len > BLIT_MAX_CHARS) return false;
+
+    GlyphCache::Tile tiles[BLIT_MAX_CHARS];
+    width = 0;
+    for (size_t i = 0; i < len; i++) {
+        if (!glyphs->get(str[i], font, text.size, text.fg, text.bg, tiles[i])) return false;
+        width += tiles[i].w;
+    }
+
+    alignText(width, tiles[0].h, x, y);
+    for (size_t i = 0; i < len; i++) {
+        rawPixels(x, y, tiles[i].w, tiles[i].h, tiles[i].pixels);
+        x += tiles[i].w;
+    }
+    return true;
+}
+
+// 🆕 폭/높이: 캐시에 있으면 그대로, 없으면 TFT_eSPI로 한 번 측정해 저장
+//    (대상의 폰트 상태는 text와 항상 같으므로 키에 text를 그대로 씀)
+void UICanvas::measure(const char *str, uint8_t font, int16_t &w, int16_t &h) {
+    uint8_t f = font == 0 ? text.font : font;
+    if (metrics != nullptr && metrics->lookup(str, text.gfx, f, text.size, w, h)) return;
+
+    w = font == 0 ? tft->textWidth(str) : tft->textWidth(str, font);
+    h = font == 0 ? tft->fontHeight() : tft->fontHeight(font);
+    if (metrics != nullptr) metrics->store(str, text.gfx, f, text.size, w, h);
+}
+
+// 🆕 측정한 폭으로 손상 영역 등록 후 그리기
+//    내장 폰트: 정렬을 직접 계산하고 drawChar로 이어 그림
+//    (TFT_eSPI drawString은 datum과 상관없이 매번 textWidth로 글자를 다시 셈)
+//    Free Font / baseline datum: 기준선 계산이 달라 drawString에 맡김
+int16_t UICanvas::drawMeasured(const char *str, int32_t x, int32_t y, uint8_t font) {
+    int16_t w, h;
+    measure(str, font, w, h);
+    if (dirty != nullptr) {
+        DirtyRect r = textBounds(w, h, x, y);
+        mark(r.x, r.y, r.w, r.h);
+    }
+    countTx(strlen(str));   // 글자마다 drawChar가 트랜잭션을 염
+
+    bool freeFont = text.gfx != nullptr && font <= 1;
+    if (metrics == nullptr || freeFont || text.datum > BR_DATUM) {
+        return font == 0 ? tft->drawString(str, x, y) : tft->drawString(str, x, y, font);
+    }
+
+    alignText(w, h, x, y);
+    uint8_t f = font == 0 ? text.font : font;
+    int16_t width = 0;
+    for (const char *c = str; *c != '\0'; c++) {
+        width += tft->drawChar(*c, x + width, y, f);
+    }
+    return width;
+}
+
+// TFT_eSPI drawString의 datum 정렬 + 화면 안쪽 보정
+void UICanvas::alignText(int16_t w, int16_t h, int32_t &x, int32_t &y) const {
+    switch (text.datum) {
+        case TC_DATUM: x -= w / 2; break;
+        case TR_DATUM: x -= w; break;
+        case ML_DATUM: y -= h / 2; break;
+        case MC_DATUM: x -= w / 2; y -= h / 2; break;
+        case MR_DATUM: x -= w; y -= h / 2; break;
+        case BL_DATUM: y -= h; break;
+        case BC_DATUM: x -= w / 2; y -= h; break;
+        case BR_DATUM: x -= w; y -= h; break;
+        case L_BASELINE: y -= h; break;
+        case C_BASELINE: x -= w / 2; y -= h; break;
+        case R_BASELINE: x -= w; y -= h; break;
+        default: break;
+    }
+
+    // 화면 밖으로 나가면 TFT_eSPI가 안쪽으로 밀어 넣음
+    if (text.datum != TL_DATUM) {
+        if (x < 0) x = 0;
+        if (x + w > SCREEN_WIDTH) x = SCREEN_WIDTH - w;
+        if (y < 0) y = 0;
+    }
+}
+
+// ============================================
+// Damage
+// ============================================
+void UICanvas::mark(int32_t x, int32_t y, int32_t w, int32_t h) {
+    if (dirty == nullptr) return;
+    dirty->add(x, y, w, h);
+}
+
+// TFT_eSPI drawString의 datum 정렬을 따라 경계 계산
+// Free Font는 baseline 기준이라 위아래 여유를 둠
+DirtyRect UICanvas::textBounds(int16_t w, int16_t h, int32_t x, int32_t y) const {
+    alignText(w, h, x, y);
+
+    int16_t padY = h / 4;
+    return { (int16_t)(x - 2), (int16_t)(y - padY), (int16_t)(w + 4), (int16_t)(h + 2 * padY) };
+}
@@ -0,0 +1,573 @@
+// ============================================
+// TTGO Watch Sprite Compositor Implementation
+// Version: 2.5 - Off-screen Compositing
+// ============================================
+
+#include "UI-compositor.h"
+
+// CASET(1+4) + RASET(1+4) + RAMWR(1) - 윈도우 하나당 SPI 바이트
+#define WINDOW_OVERHEAD_BYTES   11
+
+static const int16_t segCount = SCREEN_WIDTH / COMPOSITOR_SEG_WIDTH;
+
+// 스프라이트 버퍼는 SPI 전송 순서(바이트 스왑)로 저장됨
+static inline uint16_t toBufferColor(uint16_t color) {
+    return (color >> 8) | (color << 8);
+}
+
+// 변경 픽셀이 범위의 COMPOSITOR_DMA_PERCENT 이상이면 행 전체를 DMA로 보냄
+static inline bool worthStreaming(int32_t changed, int32_t range) {
+    return changed * 100 >= range * COMPOSITOR_DMA_PERCENT;
+}
+
+// 손상 사각형들을 덮는 행 범위 [y0, y1)
+static void dirtyRows(const DirtyRegion &dirty, int16_t &y0, int16_t &y1) {
+    y0 = SCREEN_HEIGHT;
+    y1 = 0;
+    for (uint8_t i = 0; i < dirty.getCount(); i++) {
+        const DirtyRect &r = dirty.getRect(i);
+        y0 = min(y0, r.y);
+        y1 = max(y1, r.bottom());
+    }
+}
+
+// ============================================
+// Constructor / Destructor
+// ============================================
+SpriteCompositor::SpriteCompositor() {
+    tft = nullptr;
+    canvas = nullptr;
+    strip[0] = strip[1] = nullptr;
+    bounce[0] = bounce[1] = nullptr;
+    front = nullptr;
+    segHash = nullptr;
+    front4 = nullptr;
+    pushedVersion = 0;
+    banded = false;
+    paletted = false;
+    bandHeight = COMPOSITOR_BAND_HEIGHT;
+    clearColor = TFT_BLACK;
+
+    dmaReady = false;
+    dmaBusy = false;
+    dmaSrc = nullptr;
+    txOpen = false;
+    oldSwap = false;
+
+    lastPushBytes = 0;
+    lastPushPixels = 0;
+    lastSpanCount = 0;
+    lastDmaBands = 0;
+}
+
+SpriteCompositor::~SpriteCompositor() {
+    end();
+}
+
+// ============================================
+// Buffer Allocation
+// ============================================
+bool SpriteCompositor::begin(TFT_eSPI *panel) {
+    end();
+
+    // DMA 실패 시에도 동작 (행 전송이 블로킹 pushImage로 바뀔 뿐)
+    dmaReady = panel->initDMA();
+    _PF("Compositor: DMA %s\n", dmaReady ? "enabled" : "unavailable");
+
+    // 1) PSRAM: 전체 프레임 백버퍼 + 프론트 사본
+    //    PSRAM은 DMA 불가 → 내부 RAM 중계 버퍼 2개로 핑퐁
+    if (psramFound()) {
+        canvas = new TFT_eSprite(panel);
+        canvas->setColorDepth(16);
+
+        size_t bounceBytes = SCREEN_WIDTH * bandHeight * sizeof(uint16_t);
+        front = (uint16_t *)ps_malloc(SCREEN_WIDTH * SCREEN_HEIGHT * sizeof(uint16_t));
+        if (front != nullptr && canvas->createSprite(SCREEN_WIDTH, SCREEN_HEIGHT) != nullptr) {
+            bounce[0] = (uint16_t *)heap_caps_malloc(bounceBytes, MALLOC_CAP_DMA);
+            bounce[1] = (uint16_t *)heap_caps_malloc(bounceBytes, MALLOC_CAP_DMA);
+            if (bounce[0] == nullptr || bounce[1] == nullptr) {
+                // 중계 버퍼 없으면 span diff만 사용
+                heap_caps_free(bounce[0]);
+                heap_caps_free(bounce[1]);
+                bounce[0] = bounce[1] = nullptr;
+            }
+
+            banded = false;
+            tft = panel;
+            invalidate(TFT_BLACK);
+            _PF("Compositor: full frame (PSRAM), stream %s\n", bounce[0] ? "on" : "off");
+            return true;
+        }
+        end();
+    }
+
+#ifdef USE_PALETTE_FRAMEBUFFER
+    // 🆕 2) 내부 RAM: 4bpp 전체 프레임 (밴드보다 우선 - 모든 화면이 전체 합성)
+    if (beginPaletted(panel)) {
+        return true;
+    }
+#endif
+
+    // 3) 내부 RAM: 핑퐁 밴드 스프라이트 2개 + 세그먼트 해시
+    segHash = (uint32_t *)malloc(SCREEN_HEIGHT * segCount * sizeof(uint32_t));
+    for (int i = 0; i < 2; i++) {
+        strip[i] = new TFT_eSprite(panel);
+        strip[i]->setColorDepth(16);
+        strip[i]->setAttribute(PSRAM_ENABLE, false);
+    }
+    if (segHash != nullptr &&
+        strip[0]->createSprite(SCREEN_WIDTH, bandHeight) != nullptr &&
+        strip[1]->createSprite(SCREEN_WIDTH, bandHeight) != nullptr) {
+        banded = true;
+        tft = panel;
+        invalidate(TFT_BLACK);
+        _PF("Compositor: banded (2 x %d rows)\n", bandHeight);
+        return true;
+    }
+
+    _PL("Compositor: not enough RAM - direct drawing");
+    end();
+    panel->deInitDMA();
+    dmaReady = false;
+    return false;
+}
+
+// 백버퍼 + 패널 사본 각 28.8KB, 확장은 중계 버퍼에서만 하므로 둘 다 필요
+bool SpriteCompositor::beginPaletted(TFT_eSPI *panel) {
+    size_t frameBytes = SCREEN_WIDTH * SCREEN_HEIGHT / 2;
+    size_t bounceBytes = SCREEN_WIDTH * bandHeight * sizeof(uint16_t);
+
+    canvas = new TFT_eSprite(panel);
+    canvas->setColorDepth(4);
+    canvas->setAttribute(PSRAM_ENABLE, false);
+
+    front4 = (uint8_t *)malloc(frameBytes);
+    bounce[0] = (uint16_t *)heap_caps_malloc(bounceBytes, MALLOC_CAP_DMA);
+    bounce[1] = (uint16_t *)heap_caps_malloc(bounceBytes, MALLOC_CAP_DMA);
+
+    if (front4 != nullptr && bounce[0] != nullptr && bounce[1] != nullptr &&
+        canvas->createSprite(SCREEN_WIDTH, SCREEN_HEIGHT) != nullptr) {
+        pal.reset();
+        pal.setPixels((const uint8_t *)canvas->getPointer(), front4, frameBytes);
+        paletted = true;
+        banded = false;
+        tft = panel;
+        invalidate(TFT_BLACK);
+        _PF("Compositor: full frame (4bpp palette, %u bytes)\n", (unsigned)frameBytes);
+        return true;
+    }
+
+    end();
+    return false;
+}
+
+void SpriteCompositor::end() {
+    if (tft != nullptr) sync();
+
+    if (canvas != nullptr) {
+        canvas->deleteSprite();
+        delete canvas;
+        canvas = nullptr;
+    }
+    for (int i = 0; i < 2; i++) {
+        if (strip[i] != nullptr) {
+            strip[i]->deleteSprite();
+            delete strip[i];
+            strip[i] = nullptr;
+        }
+        heap_caps_free(bounce[i]);
+        bounce[i] = nullptr;
+    }
+    free(front);
+    front = nullptr;
+    free(front4);
+    front4 = nullptr;
+    paletted = false;
+    free(segHash);
+    segHash = nullptr;
+    tft = nullptr;
+}
+
+void SpriteCompositor::invalidate(uint16_t panelColor) {
+    clearColor = panelColor;
+
+    if (front != nullptr) {
+        uint16_t c = toBufferColor(panelColor);
+        for (int i = 0; i < SCREEN_WIDTH * SCREEN_HEIGHT; i++) {
+            front[i] = c;
+        }
+    }
+
+    if (front4 != nullptr) {
+        uint8_t idx = pal.indexOf(panelColor);
+        memset(front4, (idx << 4) | idx, SCREEN_WIDTH * SCREEN_HEIGHT / 2);
+        pushedVersion = pal.getVersion();
+    }
+
+    if (segHash != nullptr) {
+        uint32_t h = solidHash(panelColor);
+        for (int i = 0; i < SCREEN_HEIGHT * segCount; i++) {
+            segHash[i] = h;
+        }
+    }
+}
+
+void SpriteCompositor::fillPanel(uint16_t color) {
+    if (!isReady()) return;
+
+    beginPush();
+    resetStats();
+
+    if (banded) {
+        // 같은 색으로 채운 밴드 하나를 위치만 바꿔 반복 전송
+        strip[0]->fillSprite(color);
+        uint16_t *buf = (uint16_t *)strip[0]->getPointer();
+        for (int16_t y0 = 0; y0 < SCREEN_HEIGHT; y0 += bandHeight) {
+            pushRows(buf, y0, min((int16_t)(SCREEN_HEIGHT - y0), bandHeight));
+        }
+    } else if (paletted) {
+        canvas->fillSprite(pal.indexOf(color));
+        streamRows4(0, SCREEN_HEIGHT);
+    } else {
+        canvas->fillSprite(color);
+        streamRows((const uint16_t *)canvas->getPointer(), 0, SCREEN_HEIGHT);
+    }
+
+    invalidate(color);
+    endPush();
+}
+
+// ============================================
+// SPI Transaction / DMA
+// ============================================
+// 버퍼 → 패널 직접 전송 (pushSprite와 동일하게 스왑 해제)
+void SpriteCompositor::beginPush() {
+    sync();
+    oldSwap = tft->getSwapBytes();
+    tft->setSwapBytes(false);
+    tft->startWrite();
+    txOpen = true;
+}
+
+// 마지막 DMA가 진행 중이면 트랜잭션을 열어둔 채 반환 → 다음 sync()에서 종료
+void SpriteCompositor::endPush() {
+    tft->setSwapBytes(oldSwap);
+    if (!dmaBusy) {
+        tft->endWrite();
+        txOpen = false;
+    }
+}
+
+void SpriteCompositor::waitDma() {
+    if (!dmaBusy) return;
+    tft->dmaWait();
+    dmaBusy = false;
+}
+
+void SpriteCompositor::sync() {
+    if (!txOpen) return;
+    waitDma();
+    tft->endWrite();
+    txOpen = false;
+}
+
+// ============================================
+// Compose
+// ============================================
+void SpriteCompositor::compose(const PaintFn &paint) {
+    if (!isReady()) return;
+
+    if (!banded) {
+        DirtyRegion all;
+        all.addAll();
+        sync();
+        paint(canvas, false);
+        present(all);
+        return;
+    }
+
+    beginPush();
+    resetStats();
+
+    // 밴드 k를 DMA로 보내는 동안 밴드 k+1을 다른 스프라이트에 그림
+    int cur = 0;
+    for (int16_t y0 = 0; y0 < SCREEN_HEIGHT; y0 += bandHeight) {
+        int16_t rows = min((int16_t)(SCREEN_HEIGHT - y0), bandHeight);
+        TFT_eSprite *band = strip[cur];
+        uint16_t *px = (uint16_t *)band->getPointer();
+
+        // 🆕 변경 없는 밴드는 전송을 안 하므로 밴드 k의 DMA가 k+2까지 남을 수 있음
+        //    → 이 스프라이트가 아직 DMA 소스면 다 보낼 때까지 대기
+        if (dmaBusy && dmaSrc >= px && dmaSrc < px + SCREEN_WIDTH * bandHeight) {
+            waitDma();
+        }
+
+        band->fillSprite(clearColor);
+        band->setViewport(0, -y0, SCREEN_WIDTH, SCREEN_HEIGHT, true);
+        paint(band, true);
+        band->resetViewport();
+
+        diffBand(px, y0, rows);
+        cur ^= 1;
+    }
+
+    endPush();
+}
+
+void SpriteCompositor::present(const DirtyRegion &dirty) {
+    if (!isReady() || banded) return;
+
+    sync();
+    resetStats();
+
+    // 🆕 4bpp: 팔레트가 바뀌었으면 다시 그리지 않고 전체 재전송
+    bool recolor = paletted && pushedVersion != pal.getVersion();
+    if (dirty.isEmpty() && !recolor) return;
+
+    int16_t y0, y1;
+    if (paletted) {
+        beginPush();
+        if (recolor) {
+            streamRows4(0, SCREEN_HEIGHT);
+            pushedVersion = pal.getVersion();
+        } else if (worthStreaming(dirty.getArea(), (int32_t)SCREEN_WIDTH * SCREEN_HEIGHT)) {
+            dirtyRows(dirty, y0, y1);
+            streamRows4(y0, y1);
+        } else {
+            for (uint8_t i = 0; i < dirty.getCount(); i++) {
+                diffRect4(dirty.getRect(i));
+            }
+        }
+        endPush();
+        return;
+    }
+
+    const uint16_t *back = (const uint16_t *)canvas->getPointer();
+
+    beginPush();
+
+    if (bounce[0] != nullptr &&
+        worthStreaming(dirty.getArea(), (int32_t)SCREEN_WIDTH * SCREEN_HEIGHT)) {
+        // 큰 변경 (화면 전환 등): 손상 행 범위 전체를 핑퐁 DMA로 스트리밍
+        dirtyRows(dirty, y0, y1);
+        streamRows(back, y0, y1);
+    } else {
+        // 사각형이 겹쳐도 프론트 사본이 갱신되므로 두 번 push되지 않음
+        for (uint8_t i = 0; i < dirty.getCount(); i++) {
+            diffRect(back, dirty.getRect(i));
+        }
+    }
+
+    endPush();
+}
+
+void SpriteCompositor::resetStats() {
+    lastPushBytes = 0;
+    lastPushPixels = 0;
+    lastSpanCount = 0;
+    lastDmaBands = 0;
+}
+
+void SpriteCompositor::pushSpan(const uint16_t *src, int16_t x, int16_t y, int16_t w) {
+    // 블로킹 전송 전에 진행 중인 DMA 완료 대기
+    waitDma();
+    tft->setAddrWindow(x, y, w, 1);
+    tft->pushPixels(src, w);
+
+    lastPushBytes += WINDOW_OVERHEAD_BYTES + w * sizeof(uint16_t);
+    lastPushPixels += w;
+    lastSpanCount++;
+}
+
+// 전체 폭 행 묶음 전송 - DMA면 완료를 기다리지 않고 반환
+void SpriteCompositor::pushRows(uint16_t *src, int16_t y, int16_t rows) {
+    waitDma();
+    if (dmaReady) {
+        tft->pushImageDMA(0, y, SCREEN_WIDTH, rows, src);
+        dmaBusy = true;
+        dmaSrc = src;
+    } else {
+        tft->pushImage(0, y, SCREEN_WIDTH, rows, src);
+    }
+
+    lastPushBytes += WINDOW_OVERHEAD_BYTES + SCREEN_WIDTH * rows * sizeof(uint16_t);
+    lastPushPixels += SCREEN_WIDTH * rows;
+    lastDmaBands++;
+}
+
+// 전체 모드: 프론트 사본과 픽셀 비교, 가까운 변경은 하나의 span으로 병합
+void SpriteCompositor::diffRect(const uint16_t *back, const DirtyRect &r) {
+    for (int16_t y = r.y; y < r.bottom(); y++) {
+        const uint16_t *src = back + y * SCREEN_WIDTH;
+        uint16_t *dst = front + y * SCREEN_WIDTH;
+
+        if (memcmp(src + r.x, dst + r.x, r.w * sizeof(uint16_t)) == 0) continue;
+
+        int16_t spanStart = -1;
+        int16_t spanEnd = -1;
+        for (int16_t x = r.x; x < r.right(); x++) {
+            if (src[x] == dst[x]) continue;
+
+            if (spanStart >= 0 && x - spanEnd > COMPOSITOR_SPAN_GAP) {
+                int16_t w = spanEnd - spanStart + 1;
+                pushSpan(src + spanStart, spanStart, y, w);
+                memcpy(dst + spanStart, src + spanStart, w * sizeof(uint16_t));
+                spanStart = -1;
+            }
+            if (spanStart < 0) spanStart = x;
+            spanEnd = x;
+        }
+
+        if (spanStart >= 0) {
+            int16_t w = spanEnd - spanStart + 1;
+            pushSpan(src + spanStart, spanStart, y, w);
+            memcpy(dst + spanStart, src + spanStart, w * sizeof(uint16_t));
+        }
+    }
+}
+
+// 전체 모드: PSRAM 백버퍼 → 중계 버퍼 복사가 이전 밴드 DMA와 겹침
+void SpriteCompositor::streamRows(const uint16_t *back, int16_t y0, int16_t y1) {
+    int cur = 0;
+    for (int16_t y = y0; y < y1; y += bandHeight) {
+        int16_t rows = min((int16_t)(y1 - y), bandHeight);
+        size_t bytes = SCREEN_WIDTH * rows * sizeof(uint16_t);
+        const uint16_t *src = back + y * SCREEN_WIDTH;
+
+        // bounce[cur]의 이전 전송은 pushRows의 waitDma에서 이미 끝남
+        memcpy(bounce[cur], src, bytes);
+        memcpy(front + y * SCREEN_WIDTH, src, bytes);
+        pushRows(bounce[cur], y, rows);
+        cur ^= 1;
+    }
+}
+
+// 🆕 4bpp 모드: 인덱스 바이트(2픽셀) 단위 비교 → 변경 span만 확장해서 전송
+void SpriteCompositor::diffRect4(const DirtyRect &r) {
+    const uint8_t *back = (const uint8_t *)canvas->getPointer();
+    const int16_t rowBytes = SCREEN_WIDTH / 2;
+    const int16_t gap = (COMPOSITOR_SPAN_GAP + 1) / 2;
+    int16_t b0 = r.x >> 1;
+    int16_t b1 = (r.right() + 1) >> 1;
+
+    for (int16_t y = r.y; y < r.bottom(); y++) {
+        const uint8_t *src = back + y * rowBytes;
+        uint8_t *dst = front4 + y * rowBytes;
+
+        if (memcmp(src + b0, dst + b0, b1 - b0) == 0) continue;
+
+        auto flush = [&](int16_t s, int16_t e) {
+            // pushSpan 전에 DMA가 끝나야 중계 버퍼에 확장 가능
+            waitDma();
+            pal.expand(src, s * 2, (e - s + 1) * 2, bounce[0]);
+            pushSpan(bounce[0], s * 2, y, (e - s + 1) * 2);
+            memcpy(dst + s, src + s, e - s + 1);
+        };
+
+        int16_t spanStart = -1;
+        int16_t spanEnd = -1;
+        for (int16_t b = b0; b < b1; b++) {
+            if (src[b] == dst[b]) continue;
+
+            if (spanStart >= 0 && b - spanEnd > gap) {
+                flush(spanStart, spanEnd);
+                spanStart = -1;
+            }
+            if (spanStart < 0) spanStart = b;
+            spanEnd = b;
+        }
+        if (spanStart >= 0) {
+            flush(spanStart, spanEnd);
+        }
+    }
+}
+
+// 🆕 4bpp 모드: 행 묶음을 중계 버퍼에 RGB565로 확장하면서 이전 밴드 DMA와 겹침
+void SpriteCompositor::streamRows4(int16_t y0, int16_t y1) {
+    const uint8_t *back = (const uint8_t *)canvas->getPointer();
+    const int16_t rowBytes = SCREEN_WIDTH / 2;
+    int cur = 0;
+    for (int16_t y = y0; y < y1; y += bandHeight) {
+        int16_t rows = min((int16_t)(y1 - y), bandHeight);
+
+        for (int16_t r = 0; r < rows; r++) {
+            pal.expand(back + (y + r) * rowBytes, 0, SCREEN_WIDTH, bounce[cur] + r * SCREEN_WIDTH);
+        }
+        memcpy(front4 + y * rowBytes, back + y * rowBytes, rows * rowBytes);
+        pushRows(bounce[cur], y, rows);
+        cur ^= 1;
+    }
+}
+
+// 밴드 모드: 이전 픽셀이 없으므로 세그먼트 해시로 변경 여부 판단
+//   변경이 많으면 변경 행 범위를 DMA 한 번으로, 적으면 span으로 전송
+void SpriteCompositor::diffBand(uint16_t *band, int16_t y0, int16_t rows) {
+    uint32_t rowMask[COMPOSITOR_BAND_HEIGHT];
+    int16_t firstRow = -1;
+    int16_t lastRow = -1;
+    int32_t changedPixels = 0;
+
+    for (int16_t r = 0; r < rows; r++) {
+        const uint16_t *src = band + r * SCREEN_WIDTH;
+        uint32_t *hashRow = segHash + (y0 + r) * segCount;
+
+        rowMask[r] = 0;
+        for (int16_t s = 0; s < segCount; s++) {
+            uint32_t h = hashSegment(src + s * COMPOSITOR_SEG_WIDTH);
+            if (h != hashRow[s]) {
+                hashRow[s] = h;
+                rowMask[r] |= 1UL << s;
+                changedPixels += COMPOSITOR_SEG_WIDTH;
+            }
+        }
+
+        if (rowMask[r] != 0) {
+            if (firstRow < 0) firstRow = r;
+            lastRow = r;
+        }
+    }
+
+    if (firstRow < 0) return;
+
+    int16_t rangeRows = lastRow - firstRow + 1;
+    if (worthStreaming(changedPixels, (int32_t)SCREEN_WIDTH * rangeRows)) {
+        pushRows(band + firstRow * SCREEN_WIDTH, y0 + firstRow, rangeRows);
+        return;
+    }
+
+    for (int16_t r = firstRow; r <= lastRow; r++) {
+        const uint16_t *src = band + r * SCREEN_WIDTH;
+        int16_t runStart = -1;
+        for (int16_t s = 0; s <= segCount; s++) {
+            bool changed = s < segCount && (rowMask[r] & (1UL << s));
+
+            if (changed && runStart < 0) {
+                runStart = s;
+            } else if (!changed && runStart >= 0) {
+                int16_t x = runStart * COMPOSITOR_SEG_WIDTH;
+                pushSpan(src + x, x, y0 + r, (s - runStart) * COMPOSITOR_SEG_WIDTH);
+                runStart = -1;
+            }
+        }
+    }
+}
+
+// ============================================
+// Segment Hash (FNV-1a)
+// ============================================
+uint32_t SpriteCompositor::hashSegment(const uint16_t *px) const {
+    uint32_t h = 2166136261UL;
+    for (int i = 0; i < COMPOSITOR_SEG_WIDTH; i++) {
+        h = (h ^ px[i]) * 16777619UL;
+    }
+    return h;
+}
+
+uint32_t SpriteCompositor::solidHash(uint16_t color) const {
+    uint16_t seg[COMPOSITOR_SEG_WIDTH];
+    uint16_t c = toBufferColor(color);
+    for (int i = 0; i < COMPOSITOR_SEG_WIDTH; i++) {
+        seg[i] = c;
+    }
+    return hashSegment(seg);
+}
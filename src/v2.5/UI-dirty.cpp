@@ -0,0 +1,167 @@
+// ============================================
+// TTGO Watch Dirty Rectangle Tracker Implementation
+// Version: 2.5 - Damage Tracking
+// ============================================
+
+#include "UI-dirty.h"
+
+DirtyRegion::DirtyRegion() {
+    count = 0;
+    lastArea = 0;
+    lastCount = 0;
+    frameCount = 0;
+}
+
+// ============================================
+// Register
+// ============================================
+void DirtyRegion::add(int16_t x, int16_t y, int16_t w, int16_t h) {
+    // 화면 밖 클리핑
+    if (x < 0) { w += x; x = 0; }
+    if (y < 0) { h += y; y = 0; }
+    if (x + w > SCREEN_WIDTH) w = SCREEN_WIDTH - x;
+    if (y + h > SCREEN_HEIGHT) h = SCREEN_HEIGHT - y;
+    if (w <= 0 || h <= 0) return;
+
+    insert({ x, y, w, h });
+}
+
+void DirtyRegion::addAll() {
+    count = 0;
+    insert({ 0, 0, SCREEN_WIDTH, SCREEN_HEIGHT });
+}
+
+void DirtyRegion::clear() {
+    count = 0;
+}
+
+// 🆕 합집합 넓이 (병합 낭비가 커서 겹친 채 남은 사각형도 한 번만 셈)
+//    사각형의 위/아래 경계로 가로 띠를 나누고, 띠마다 덮는 x 구간을 합침
+int32_t DirtyRegion::getArea() const {
+    int16_t ys[DIRTY_MAX_RECTS * 2];
+    uint8_t n = 0;
+    for (uint8_t i = 0; i < count; i++) {
+        ys[n++] = rects[i].y;
+        ys[n++] = rects[i].bottom();
+    }
+    sortEdges(ys, n);
+
+    int32_t total = 0;
+    for (uint8_t k = 0; k + 1 < n; k++) {
+        int16_t y0 = ys[k];
+        int16_t y1 = ys[k + 1];
+        if (y0 == y1) continue;
+
+        // 이 띠를 덮는 사각형의 x 구간 (왼쪽 기준 정렬)
+        DirtyRect spans[DIRTY_MAX_RECTS];
+        uint8_t m = 0;
+        for (uint8_t i = 0; i < count; i++) {
+            if (rects[i].y > y0 || rects[i].bottom() < y1) continue;
+            uint8_t j = m++;
+            while (j > 0 && spans[j - 1].x > rects[i].x) {
+                spans[j] = spans[j - 1];
+                j--;
+            }
+            spans[j] = rects[i];
+        }
+
+        int32_t width = 0;
+        int16_t start = 0;
+        int16_t end = 0;
+        for (uint8_t j = 0; j < m; j++) {
+            if (spans[j].x > end) {
+                width += end - start;
+                start = spans[j].x;
+                end = spans[j].right();
+            } else {
+                end = max(end, spans[j].right());
+            }
+        }
+        width += end - start;
+        total += width * (y1 - y0);
+    }
+    return total;
+}
+
+void DirtyRegion::sortEdges(int16_t *v, uint8_t n) {
+    for (uint8_t i = 1; i < n; i++) {
+        int16_t e = v[i];
+        uint8_t j = i;
+        while (j > 0 && v[j - 1] > e) {
+            v[j] = v[j - 1];
+            j--;
+        }
+        v[j] = e;
+    }
+}
+
+bool DirtyRegion::intersects(const DirtyRect &r) const {
+    for (uint8_t i = 0; i < count; i++) {
+        if (rects[i].overlaps(r)) return true;
+    }
+    return false;
+}
+
+void DirtyRegion::endFrame() {
+    lastArea = getArea();
+    lastCount = count;
+    frameCount++;
+    count = 0;
+}
+
+// ============================================
+// Merge
+// ============================================
+// 합쳤을 때 새로 덮이는 (원래 깨끗한) 픽셀 수
+int32_t DirtyRegion::mergeWaste(const DirtyRect &a, const DirtyRect &b) {
+    int32_t overlap = 0;
+    int16_t ix = max(a.x, b.x);
+    int16_t iy = max(a.y, b.y);
+    int16_t iw = min(a.right(), b.right()) - ix;
+    int16_t ih = min(a.bottom(), b.bottom()) - iy;
+    if (iw > 0 && ih > 0) {
+        overlap = (int32_t)iw * ih;
+    }
+    return a.unite(b).area() - (a.area() + b.area() - overlap);
+}
+
+void DirtyRegion::insert(DirtyRect r) {
+    // 병합 결과가 다른 사각형과 다시 붙을 수 있으므로 반복
+    bool merged = true;
+    while (merged) {
+        merged = false;
+        for (uint8_t i = 0; i < count; i++) {
+            if (rects[i].contains(r)) return;
+            if (r.contains(rects[i]) ||
+                (rects[i].touches(r) && mergeWaste(rects[i], r) <= DIRTY_MERGE_WASTE)) {
+                r = r.unite(rects[i]);
+                removeAt(i);
+                merged = true;
+                break;
+            }
+        }
+    }
+
+    if (count < DIRTY_MAX_RECTS) {
+        rects[count++] = r;
+        return;
+    }
+
+    // 꽉 찼으면 낭비가 가장 적은 사각형과 강제 병합
+    uint8_t best = 0;
+    int32_t bestWaste = INT32_MAX;
+    for (uint8_t i = 0; i < count; i++) {
+        int32_t waste = mergeWaste(rects[i], r);
+        if (waste < bestWaste) {
+            bestWaste = waste;
+            best = i;
+        }
+    }
+    DirtyRect u = rects[best].unite(r);
+    removeAt(best);
+    insert(u);
+}
+
+void DirtyRegion::removeAt(uint8_t i) {
+    rects[i] = rects[--count];
+}
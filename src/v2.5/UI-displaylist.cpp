@@ -0,0 +1,147 @@
+// ============================================
+// TTGO Watch Display List Implementation
+// Version: 2.5 - Recorded Drawing
+// ============================================
+
+#include "UI-displaylist.h"
+
+// ============================================
+// Op Bounds (UICanvas의 손상 영역과 같은 계산)
+// ============================================
+DirtyRect DisplayOp::bounds() const {
+    switch (op) {
+        case DrawOp::FILL_SCREEN:
+            return { 0, 0, SCREEN_WIDTH, SCREEN_HEIGHT };
+        case DrawOp::FILL_RECT:
+        case DrawOp::DRAW_RECT:
+        case DrawOp::PUSH_RAW:
+        case DrawOp::PUSH_RUNS:
+        case DrawOp::AA_GLYPH:
+        case DrawOp::STORE_GLYPH:
+            return { p[0], p[1], p[2], p[3] };
+        case DrawOp::DRAW_CIRCLE:
+        case DrawOp::FILL_CIRCLE:
+        case DrawOp::STAMP_DOT:
+            return { (int16_t)(p[0] - p[2]), (int16_t)(p[1] - p[2]),
+                     (int16_t)(2 * p[2] + 1), (int16_t)(2 * p[2] + 1) };
+        case DrawOp::DRAW_LINE:
+            return { min(p[0], p[2]), min(p[1], p[3]),
+                     (int16_t)(abs(p[2] - p[0]) + 1), (int16_t)(abs(p[3] - p[1]) + 1) };
+        case DrawOp::FILL_TRIANGLE: {
+            int16_t l = min(p[0], min(p[2], p[4]));
+            int16_t t = min(p[1], min(p[3], p[5]));
+            return { l, t, (int16_t)(max(p[0], max(p[2], p[4])) - l + 1),
+                           (int16_t)(max(p[1], max(p[3], p[5])) - t + 1) };
+        }
+        case DrawOp::TEXT:
+            return { p[2], p[3], p[4], p[5] };
+    }
+    return { 0, 0, SCREEN_WIDTH, SCREEN_HEIGHT };
+}
+
+// ============================================
+// Recording
+// ============================================
+DisplayList::DisplayList() {
+    clear();
+}
+
+void DisplayList::clear() {
+    count = 0;
+    textUsed = 0;
+}
+
+bool DisplayList::add(const DisplayOp &op) {
+    if (count >= DLIST_MAX_OPS) return false;
+    ops[count++] = op;
+    return true;
+}
+
+// 문자열 영역: [TextState][문자열\0]
+bool DisplayList::addText(DisplayOp op, const TextState &state, const char *str) {
+    size_t len = strlen(str);
+    size_t need = sizeof(TextState) + len + 1;
+    if (count >= DLIST_MAX_OPS || textUsed + need > DLIST_TEXT_BYTES) return false;
+
+    op.text = textUsed;
+    op.textLen = len;
+    memcpy(text + textUsed, &state, sizeof(TextState));
+    memcpy(text + textUsed + sizeof(TextState), str, len + 1);
+    textUsed += need;
+
+    ops[count++] = op;
+    return true;
+}
+
+TextState DisplayList::stateOf(const DisplayOp &op) const {
+    TextState s;
+    memcpy(&s, text + op.text, sizeof(TextState));
+    return s;
+}
+
+const char *DisplayList::stringOf(const DisplayOp &op) const {
+    return text + op.text + sizeof(TextState);
+}
+
+// ============================================
+// Diff
+// ============================================
+bool DisplayList::same(const DisplayOp &a, const DisplayList &other, const DisplayOp &b) const {
+    if (a.op != b.op || a.color != b.color || a.font != b.font || a.data != b.data) return false;
+    if (memcmp(a.p, b.p, sizeof(a.p)) != 0) return false;
+    if (a.op != DrawOp::TEXT) return true;
+
+    return a.textLen == b.textLen &&
+           stateOf(a) == other.stateOf(b) &&
+           memcmp(stringOf(a), other.stringOf(b), a.textLen) == 0;
+}
+
+uint16_t DisplayList::diff(const DisplayList &prev, bool *emit) const {
+    // 손상 영역은 병합되며 커지기만 함 (실제보다 넓게 잡으면 더 실행할 뿐 결과는 같음)
+    DirtyRegion damage;
+    uint16_t j = 0;
+
+    // 1) 같은 op를 이전 목록에서 순서대로 찾음 (건너뛴 이전 op = 사라진 op)
+    for (uint16_t i = 0; i < count; i++) {
+        uint16_t k = j;
+        while (k < prev.count && !same(ops[i], prev, prev.ops[k])) k++;
+
+        if (k < prev.count) {
+            for (; j < k; j++) {
+                DirtyRect r = prev.ops[j].bounds();
+                damage.add(r.x, r.y, r.w, r.h);
+            }
+            j = k + 1;
+            emit[i] = false;
+        } else {
+            DirtyRect r = ops[i].bounds();
+            damage.add(r.x, r.y, r.w, r.h);
+            emit[i] = true;
+        }
+    }
+    for (; j < prev.count; j++) {
+        DirtyRect r = prev.ops[j].bounds();
+        damage.add(r.x, r.y, r.w, r.h);
+    }
+
+    // 2) 손상 영역에 닿는 op도 다시 실행 → 그 op가 덮는 영역도 손상 (더 안 늘 때까지)
+    bool grew = true;
+    while (grew) {
+        grew = false;
+        for (uint16_t i = 0; i < count; i++) {
+            if (emit[i]) continue;
+            DirtyRect r = ops[i].bounds();
+            if (damage.intersects(r)) {
+                emit[i] = true;
+                damage.add(r.x, r.y, r.w, r.h);
+                grew = true;
+            }
+        }
+    }
+
+    uint16_t emitted = 0;
+    for (uint16_t i = 0; i < count; i++) {
+        if (emit[i]) emitted++;
+    }
+    return emitted;
+}
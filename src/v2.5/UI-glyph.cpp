@@ -0,0 +1,154 @@
+// ============================================
+// TTGO Watch Glyph Blit Cache Implementation
+// Version: 2.5 - RGB565 Glyph Tiles
+// ============================================
+
+#include "UI-glyph.h"
+
+GlyphCache::GlyphCache() {
+    tft = nullptr;
+    pool = nullptr;
+    useClock = 0;
+    for (int i = 0; i < GLYPH_CACHE_SLOTS; i++) {
+        slots[i].used = false;
+    }
+    resetStats();
+}
+
+GlyphCache::~GlyphCache() {
+    end();
+}
+
+// ============================================
+// Pool Allocation (PSRAM 우선)
+// ============================================
+bool GlyphCache::begin(TFT_eSPI *panel) {
+    end();
+
+    size_t bytes = GLYPH_CACHE_SLOTS * GLYPH_SLOT_PIXELS * sizeof(uint16_t);
+    if (psramFound()) {
+        pool = (uint16_t *)ps_malloc(bytes);
+    }
+    if (pool == nullptr) {
+        pool = (uint16_t *)malloc(bytes);
+    }
+    if (pool == nullptr) {
+        _PL("GlyphCache: no RAM - drawString fallback");
+        return false;
+    }
+
+    tft = panel;
+    _PF("GlyphCache: %d slots x %d px (%u bytes)\n", GLYPH_CACHE_SLOTS, GLYPH_SLOT_PIXELS, bytes);
+    return true;
+}
+
+void GlyphCache::end() {
+    free(pool);
+    pool = nullptr;
+    tft = nullptr;
+    for (int i = 0; i < GLYPH_CACHE_SLOTS; i++) {
+        slots[i].used = false;
+    }
+}
+
+// Free Font은 배경을 칠하지 않으므로 타일에 배경을 구울 수 없음
+bool GlyphCache::supports(uint8_t font, uint16_t fg, uint16_t bg) {
+    return fg != bg && (font == 1 || font == 2 || font == 4);
+}
+
+// ============================================
+// Lookup
+// ============================================
+bool GlyphCache::get(char c, uint8_t font, uint8_t size, uint16_t fg, uint16_t bg, Tile &tile) {
+    if (!isReady()) return false;
+
+    int s = findSlot(c, font, size, fg, bg);
+    if (s >= 0) {
+        hits++;
+    } else {
+        misses++;
+        s = rasterize(c, font, size, fg, bg);
+        if (s < 0) return false;
+    }
+
+    slots[s].lastUse = ++useClock;
+    tile.pixels = pool + s * GLYPH_SLOT_PIXELS;
+    tile.w = slots[s].w;
+    tile.h = slots[s].h;
+    return true;
+}
+
+int GlyphCache::findSlot(char c, uint8_t font, uint8_t size, uint16_t fg, uint16_t bg) const {
+    for (int i = 0; i < GLYPH_CACHE_SLOTS; i++) {
+        const Slot &s = slots[i];
+        if (s.used && s.c == c && s.font == font && s.size == size && s.fg == fg && s.bg == bg) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// 빈 슬롯 우선, 없으면 가장 오래 안 쓴 슬롯
+int GlyphCache::victimSlot() {
+    int victim = 0;
+    for (int i = 0; i < GLYPH_CACHE_SLOTS; i++) {
+        if (!slots[i].used) return i;
+        if (slots[i].lastUse < slots[victim].lastUse) victim = i;
+    }
+    evictions++;
+    return victim;
+}
+
+// 임시 스프라이트에 TFT_eSPI로 한 글자를 그린 뒤 버퍼 복사, 들어간 슬롯 반환
+// 크기 초과/할당 실패면 -1 (기존 타일은 그대로 - 교체는 그린 뒤에만)
+int GlyphCache::rasterize(char c, uint8_t font, uint8_t size, uint16_t fg, uint16_t bg) {
+    char str[2] = {c, 0};
+
+    // 패널 텍스트 상태를 건드리지 않도록 임시 스프라이트로 측정
+    TFT_eSprite tmp(tft);
+    tmp.setTextSize(size);
+    int16_t w = tmp.textWidth(str, font);
+    int16_t h = tmp.fontHeight(font);
+    if (w <= 0 || h <= 0 || w * h > GLYPH_SLOT_PIXELS || w > 255 || h > 255) return -1;
+
+    tmp.setColorDepth(16);
+    tmp.setAttribute(PSRAM_ENABLE, false);
+    if (tmp.createSprite(w, h) == nullptr) return -1;
+
+    tmp.fillSprite(bg);
+    tmp.setTextDatum(TL_DATUM);
+    tmp.setTextColor(fg, bg);
+    tmp.drawString(str, 0, 0, font);
+
+    int slot = victimSlot();
+    memcpy(pool + slot * GLYPH_SLOT_PIXELS, tmp.getPointer(), w * h * sizeof(uint16_t));
+    tmp.deleteSprite();
+
+    Slot &s = slots[slot];
+    s.used = true;
+    s.c = c;
+    s.font = font;
+    s.size = size;
+    s.w = w;
+    s.h = h;
+    s.fg = fg;
+    s.bg = bg;
+    return slot;
+}
+
+// ============================================
+// Statistics
+// ============================================
+uint8_t GlyphCache::getUsedSlots() const {
+    uint8_t n = 0;
+    for (int i = 0; i < GLYPH_CACHE_SLOTS; i++) {
+        if (slots[i].used) n++;
+    }
+    return n;
+}
+
+void GlyphCache::resetStats() {
+    hits = 0;
+    misses = 0;
+    evictions = 0;
+}
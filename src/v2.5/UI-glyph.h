@@ -0,0 +1,72 @@
+// ============================================
+// TTGO Watch Glyph Blit Cache
+// Version: 2.5 - RGB565 Glyph Tiles
+// ============================================
+#ifndef UI_GLYPH_H
+#define UI_GLYPH_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// ============================================
+// GlyphCache
+//   - 내장 폰트(1/2/4) 글자를 처음 사용할 때 RGB565 타일로 래스터화
+//   - fg/bg 색과 textSize까지 키에 포함 → 이후엔 pushImage 한 번
+//   - 고정 크기 슬롯 GLYPH_CACHE_SLOTS개, 가득 차면 LRU 교체
+// ============================================
+class GlyphCache {
+public:
+    struct Tile {
+        const uint16_t *pixels;     // 스프라이트 버퍼 순서
+        uint8_t w;
+        uint8_t h;
+    };
+
+    GlyphCache();
+    ~GlyphCache();
+
+    bool begin(TFT_eSPI *panel);
+    void end();
+    bool isReady() const { return pool != nullptr; }
+
+    // 캐시 가능한 글자인지 (내장 폰트 + 배경색 있음)
+    static bool supports(uint8_t font, uint16_t fg, uint16_t bg);
+
+    // 없으면 래스터화해서 넣음. 슬롯보다 크면 false
+    bool get(char c, uint8_t font, uint8_t size, uint16_t fg, uint16_t bg, Tile &tile);
+
+    // 통계 (크기 조정용)
+    uint32_t getHits() const { return hits; }
+    uint32_t getMisses() const { return misses; }
+    uint32_t getEvictions() const { return evictions; }
+    uint8_t getUsedSlots() const;
+    void resetStats();
+
+private:
+    struct Slot {
+        bool used;
+        char c;
+        uint8_t font;
+        uint8_t size;
+        uint8_t w;
+        uint8_t h;
+        uint16_t fg;
+        uint16_t bg;
+        uint32_t lastUse;
+    };
+
+    TFT_eSPI *tft;
+    uint16_t *pool;
+    Slot slots[GLYPH_CACHE_SLOTS];
+    uint32_t useClock;
+
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t evictions;
+
+    int findSlot(char c, uint8_t font, uint8_t size, uint16_t fg, uint16_t bg) const;
+    int victimSlot();
+    int rasterize(char c, uint8_t font, uint8_t size, uint16_t fg, uint16_t bg);
+};
+
+#endif // UI_GLYPH_H
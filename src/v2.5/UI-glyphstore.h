@@ -0,0 +1,94 @@
+// ============================================
+// TTGO Watch Hangul Glyph Store
+// Version: 2.5 - LittleFS Glyph Streaming
+// ============================================
+#ifndef UI_GLYPHSTORE_H
+#define UI_GLYPHSTORE_H
+
+#include <Arduino.h>
+#include <LittleFS.h>
+#include "config.h"
+#include "UI-canvas.h"
+
+// ============================================
+// 글리프 저장소 파일 (tools/glyph_store.py가 BDF 폰트에서 생성, LittleFS에 업로드)
+//   [헤더 16B] "GST1", 개수(u16), 칸 높이(u8), ascent(u8), 색인 위치(u32), 비트맵 위치(u32)
+//   [색인 8B x 개수] 코드포인트(u16), 칸 폭(u8), 예약(u8), 비트맵 오프셋(u32)
+//                   → 코드포인트 오름차순 (파일 위에서 이진 탐색)
+//   [비트맵] 칸 폭 x 높이 1bpp, 행마다 바이트 정렬, MSB = 왼쪽
+//   (모두 little-endian)
+// ============================================
+
+// ============================================
+// GlyphStore
+//   - 플래시에 다 넣을 수 없는 한글 폰트(11,172자)를 파일에서 필요한 글자만 읽음
+//   - 읽은 글리프는 고정 크기 RAM 슬롯 GLYPH_STORE_SLOTS개에 보관, 가득 차면 LRU 교체
+//   - 저장소에 없는 글자도 슬롯에 기록 (같은 글자로 파일을 다시 찾지 않음)
+//   - drawString(): UTF-8 → 글자마다 canvas op 하나 (기록 모드/손상 영역 그대로)
+// ============================================
+class GlyphStore {
+public:
+    GlyphStore();
+    ~GlyphStore();
+
+    bool begin(const char *path = GLYPH_STORE_PATH);
+    void end();
+    bool isReady() const { return ready; }
+    uint8_t getHeight() const { return height; }
+
+    // UTF-8 한 글자 → 코드포인트 (BMP만, 잘못된 바이트는 '?')
+    static uint16_t nextCodepoint(const char *&s);
+
+    // 칸 폭 (저장소에 없으면 0) - 배치용이라 적중률에 세지 않음
+    uint8_t advance(uint16_t cp);
+    int16_t textWidth(const char *utf8);
+
+    // datum은 TFT_eSPI와 같은 값 (baseline datum은 칸 아래 기준)
+    int16_t drawString(UICanvas *tft, const char *utf8, int32_t x, int32_t y, uint8_t datum,
+                       uint16_t fg, uint16_t bg);
+
+    // (x, top) = 칸 왼쪽 위, 배경까지 칸 전체를 씀 (UICanvas가 op 실행 시 호출)
+    int16_t draw(TFT_eSPI *tft, uint16_t cp, int32_t x, int32_t top, uint16_t fg, uint16_t bg);
+    int16_t drawSolid(TFT_eSPI *tft, uint16_t cp, int32_t x, int32_t top, uint32_t fg, uint32_t bg);
+
+    // 통계 (크기 조정용) - drawString의 글자당 첫 조회만 셈
+    uint32_t getHits() const { return hits; }
+    uint32_t getMisses() const { return misses; }
+    uint32_t getEvictions() const { return evictions; }
+    uint8_t getHitRate() const;     // %
+    uint8_t getUsedSlots() const;
+    void resetStats();
+
+private:
+    struct Slot {
+        bool used;
+        bool found;         // false = 저장소에 없는 글자
+        uint16_t cp;
+        uint8_t advance;
+        uint32_t lastUse;
+        uint8_t bits[GLYPH_STORE_MAX_BYTES];
+    };
+
+    File file;
+    bool ready;
+    uint16_t count;
+    uint8_t height;
+    uint8_t ascent;
+    uint32_t indexOffset;
+    uint32_t bitmapOffset;
+
+    Slot slots[GLYPH_STORE_SLOTS];
+    uint32_t useClock;
+
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t evictions;
+
+    const Slot *glyphFor(uint16_t cp, bool counted = false);
+    int16_t measure(const char *utf8, bool counted);
+    bool findEntry(uint16_t cp, uint8_t &adv, uint32_t &offset);
+    bool readAt(uint32_t pos, uint8_t *buf, size_t len);
+    int victimSlot();
+};
+
+#endif // UI_GLYPHSTORE_H
@@ -0,0 +1,95 @@
+// ============================================
+// TTGO Watch Frame Rate Governor Implementation
+// Version: 2.5 - Adaptive Frame Rate
+// ============================================
+
+#include "UI-governor.h"
+
+FrameGovernor::FrameGovernor() {
+    mode = FrameMode::INTERACTIVE;
+    periodMs = FRAME_MS_CLOCK;
+    eventPending = true;    // 첫 프레임은 항상 그림
+    lastEventTime = 0;
+    resetStats();
+}
+
+void FrameGovernor::notifyEvent() {
+    eventPending = true;
+    lastEventTime = millis();
+
+    // 다음 update()를 기다리지 않고 바로 올림
+    if (mode != FrameMode::INTERACTIVE) {
+        setMode(FrameMode::INTERACTIVE, "event");
+    }
+}
+
+// ============================================
+// Mode Decision
+// ============================================
+FrameMode FrameGovernor::update(bool staticScreen, bool dimmed, uint32_t interactiveMs, uint32_t ambientMs) {
+    FrameMode next;
+    const char *reason;
+
+    if (ambientMs > 0) {
+        next = FrameMode::AMBIENT;
+        reason = "ambient";
+    } else if (millis() - lastEventTime < GOV_BOOST_MS) {
+        next = FrameMode::INTERACTIVE;
+        reason = "recent input";
+    } else if (staticScreen) {
+        next = FrameMode::EVENT_ONLY;
+        reason = "static screen";
+    } else if (dimmed) {
+        next = FrameMode::DIMMED;
+        reason = "dimmed";
+    } else {
+        next = FrameMode::INTERACTIVE;
+        reason = "animating";
+    }
+
+    if (next != mode) {
+        setMode(next, reason);
+    }
+
+    switch (mode) {
+        case FrameMode::INTERACTIVE: periodMs = interactiveMs; break;
+        case FrameMode::DIMMED:      periodMs = GOV_MS_DIMMED; break;
+        case FrameMode::EVENT_ONLY:  periodMs = GOV_MS_EVENT_POLL; break;
+        case FrameMode::AMBIENT:     periodMs = ambientMs; break;
+    }
+    return mode;
+}
+
+bool FrameGovernor::shouldRender() {
+    bool render = mode != FrameMode::EVENT_ONLY || eventPending;
+    eventPending = false;
+
+    if (render) {
+        rendered++;
+    } else {
+        skipped++;
+    }
+    return render;
+}
+
+void FrameGovernor::setMode(FrameMode m, const char *reason) {
+    _PF("Governor: %s -> %s (%s)\n", modeName(mode), modeName(m), reason);
+    mode = m;
+    switches++;
+}
+
+const char *FrameGovernor::modeName(FrameMode m) {
+    switch (m) {
+        case FrameMode::INTERACTIVE: return "INTERACTIVE";
+        case FrameMode::DIMMED:      return "DIMMED";
+        case FrameMode::EVENT_ONLY:  return "EVENT_ONLY";
+        case FrameMode::AMBIENT:     return "AMBIENT";
+    }
+    return "?";
+}
+
+void FrameGovernor::resetStats() {
+    switches = 0;
+    rendered = 0;
+    skipped = 0;
+}
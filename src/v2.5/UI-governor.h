@@ -0,0 +1,65 @@
+// ============================================
+// TTGO Watch Frame Rate Governor
+// Version: 2.5 - Adaptive Frame Rate
+// ============================================
+#ifndef UI_GOVERNOR_H
+#define UI_GOVERNOR_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// ============================================
+// Frame Modes
+// ============================================
+enum class FrameMode : uint8_t {
+    INTERACTIVE,    // 상태별 최대 속도 (시계 50fps)
+    DIMMED,         // 화면 어두움: 1fps
+    EVENT_ONLY,     // 정적 화면: 이벤트가 있을 때만 그림
+    AMBIENT         // 🆕 상시 표시: 다음 분이 바뀔 때까지 대기
+};
+
+// ============================================
+// FrameGovernor
+//   - 화면 상태(정적/애니메이션)와 밝기로 프레임 모드 결정
+//   - 터치/버튼/화면 전환 이벤트는 즉시 INTERACTIVE로 올림
+//   - 모드가 바뀔 때마다 로그로 보고
+// ============================================
+class FrameGovernor {
+public:
+    FrameGovernor();
+
+    // 터치, 버튼, 화면 전환 등
+    void notifyEvent();
+
+    // interactiveMs: 현재 화면의 INTERACTIVE 주기
+    // ambientMs: 상시 표시 중이면 다음 갱신까지 남은 시간 (0 = 상시 표시 아님)
+    FrameMode update(bool staticScreen, bool dimmed, uint32_t interactiveMs, uint32_t ambientMs = 0);
+
+    FrameMode getMode() const { return mode; }
+    uint32_t getPeriodMs() const { return periodMs; }
+
+    // 이번 루프에서 그릴지 여부 (대기 중인 이벤트를 소비)
+    bool shouldRender();
+
+    static const char *modeName(FrameMode m);
+
+    // 통계
+    uint32_t getSwitches() const { return switches; }
+    uint32_t getRendered() const { return rendered; }
+    uint32_t getSkipped() const { return skipped; }
+    void resetStats();
+
+private:
+    FrameMode mode;
+    uint32_t periodMs;
+    bool eventPending;
+    unsigned long lastEventTime;
+
+    uint32_t switches;
+    uint32_t rendered;
+    uint32_t skipped;
+
+    void setMode(FrameMode m, const char *reason);
+};
+
+#endif // UI_GOVERNOR_H
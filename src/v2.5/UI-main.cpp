@@ -17,12 +17,74 @@ static int prevRAngle = -1;
 static int prevBrightness = -1;
 static int prevBatteryPct = -1;
 static bool firstDraw = true;
+static bool speculating = false;   // 🆕 예측 렌더 중 → 궤도 점은 건드리지 않음
+
+#ifdef USE_SPECULATIVE_RENDER
+// 🆕 renderClockFace가 비교하는 이전 값 (예측 렌더 전후로 저장/복원)
+struct ClockStatics {
+    String sec, min, hr;
+    int angle;
+    int brightness;
+    int batteryPct;
+};
+
+static ClockStatics saveStatics() {
+    return { prevSec, prevMin, prevHr, prevAngle, prevBrightness, prevBatteryPct };
+}
+
+static void loadStatics(const ClockStatics &s) {
+    prevSec = s.sec;
+    prevMin = s.min;
+    prevHr = s.hr;
+    prevAngle = s.angle;
+    prevBrightness = s.brightness;
+    prevBatteryPct = s.batteryPct;
+}
+
+static bool sameStatics(const ClockStatics &a, const ClockStatics &b) {
+    return a.sec == b.sec && a.min == b.min && a.hr == b.hr && a.angle == b.angle &&
+           a.brightness == b.brightness && a.batteryPct == b.batteryPct;
+}
+
+static ClockStatics specBase;    // 예측을 그릴 때의 화면 상태
+static ClockStatics specAfter;   // 예측 프레임을 적용한 뒤의 상태
+
+static String twoDigits(int v) {
+    char buf[3];
+    snprintf(buf, sizeof(buf), "%02d", v);
+    return String(buf);
+}
+#endif
+
+// 🆕 메뉴 항목 (ScrollList가 항목 높이 단위로 그림, 창보다 많으면 드래그로 스크롤)
+static const char* menuItems[] = {
+    "1. NTP Sync",       // ✅ 추가
+    "2. Battery Info",
+    "3. Settings",
+    "4. Watch Face",
+    "5. Sleep",
+    "6. Exit"
+};
+static const uint16_t menuItemCount = sizeof(menuItems) / sizeof(menuItems[0]);
+
+#ifdef USE_HANGUL_TEXT
+// 🆕 한글 항목 (글리프 저장소가 열렸을 때만, 순서는 menuItems와 같음)
+static const char* menuItemsKo[] = {
+    "1. NTP 동기화",
+    "2. 배터리 정보",
+    "3. 설정",
+    "4. 시계 모드",
+    "5. 절전",
+    "6. 나가기"
+};
+#endif
 
 // ============================================
 // Constructor / Destructor
 // ============================================
 WatchUICLASS::WatchUICLASS() {
     lastActivityTime = 0;
+    lastInputTime = 0;
     lastUpdateTime = 0;
     lastNtpSyncTime = 0;
     sleepTimeout = AUTO_SLEEP_TIME;
@@ -111,6 +173,47 @@ void WatchUICLASS::wakeUpWatch() {
     ttgo->tft->setSwapBytes(true);
     _PL("TFT initialized (rotation=2)");
     
+    // 🆕 그리기 대상: PSRAM 백버퍼가 있으면 스프라이트, 없으면 패널
+    canvas.setTarget(ttgo->tft);
+    canvas.setDamage(&damage);
+    damage.clear();
+    
+    // 🆕 자주 쓰는 글자는 첫 사용 시 RGB565 타일로 저장 → 이후 blit
+    if (glyphs.begin(ttgo->tft)) {
+        canvas.setGlyphCache(&glyphs);
+    }
+#ifdef USE_HANGUL_TEXT
+    hangul.begin();   // 🆕 저장소 파일이 없으면 영문 그대로
+#endif
+    canvas.setMetricsCache(&metrics);   // 🆕 같은 문자열은 한 번만 측정
+    
+#ifdef STAMP_BENCHMARK
+    DotStamp::benchmark(ttgo->tft);
+#endif
+#ifdef AA_BENCHMARK
+    SegmentReadout::benchmark(ttgo->tft, &DSEG7_Modern_Bold_20, &DSEG7_Modern_Bold_20AA);
+    SegmentReadout::benchmark(ttgo->tft, &DSEG7_Classic_Regular_28, &DSEG7_Classic_Regular_28AA);
+#endif
+    
+#ifdef USE_SPRITE_COMPOSITOR
+    // 🆕 오프스크린 합성 버퍼
+    if (compositor.begin(ttgo->tft) && !compositor.isBanded()) {
+        canvas.setTarget(compositor.frame());
+        canvas.setPalette(compositor.palette());   // 🆕 4bpp 모드면 색 → 인덱스
+        if (!compositor.isPaletted()) {
+            screens.begin();
+#ifdef USE_SPECULATIVE_RENDER
+            spec.begin(ttgo->tft, canvas.getGlyphCache(), canvas.getMetricsCache());
+#endif
+        }
+    }
+#endif
+    
+#ifdef USE_SPI_BATCH
+    // 🆕 패널에 직접 그릴 때만: 프레임의 op 실행 전체를 트랜잭션 하나로
+    canvas.setBatching(canvas.getTarget() == ttgo->tft);
+#endif
+    
     ttgo->openBL();
     _PL("Backlight ON");
     
@@ -134,7 +237,11 @@ void WatchUICLASS::wakeUpWatch() {
     
     // 인터럽트
     pinMode(AXP202_INT, INPUT_PULLUP);
-    attachInterrupt(AXP202_INT, []() { irq = true; }, FALLING);
+    attachInterrupt(AXP202_INT, []() { irq = true; FramePacer::wakeFromISR(); }, FALLING);
+    
+    // 🆕 터치 인터럽트: 1fps/이벤트 대기 중에도 즉시 깨어남
+    pinMode(TOUCH_INT_PIN, INPUT);
+    attachInterrupt(TOUCH_INT_PIN, []() { FramePacer::wakeFromISR(); }, FALLING);
     
     if (power != nullptr) {
         power->enableIRQ(AXP202_PEK_SHORTPRESS_IRQ, true);
@@ -150,53 +257,50 @@ void WatchUICLASS::wakeUpWatch() {
     prevRAngle = -1;
     
     lastActivityTime = millis();
+    lastInputTime = lastActivityTime;
     _PL("Wake up complete!");
 }
 
 // ============================================
 // 🆕 Splash Screen - 부팅 화면
 // ============================================
+void WatchUICLASS::buildSplashScreen() {
+    WidgetScreen &scr = splashUi.screen;
+    
+    // 🔲 상단 로고 박스
+    scr.add(new Box(40, 30, 160, 70, COLOR_CYAN));
+    scr.add(new Box(42, 32, 156, 66, COLOR_CYAN));
+    
+    // 📝 TTGO WATCH 텍스트
+    scr.add(new Label(120, 50, "RAG", &DSEG7_Classic_Regular_28, COLOR_WHITE, TFT_BLACK));
+    scr.add(new Label(120, 80, "WATCH", &DSEG7_Modern_Bold_20, COLOR_CYAN, TFT_BLACK));
+    
+    // 🏢 회사명 / 📦 버전 정보
+    scr.add(new Label(120, 120, 0, 0, "FTH-KOREA.co", 2, COLOR_ORANGE, TFT_BLACK));
+    scr.add(new Label(120, 145, 0, 0, "Version 2.5 - NTP Support", 1, COLOR_GRAY1, TFT_BLACK));
+    
+    // 프로그레스 바 / 퍼센트 / 상태 메시지
+    splashUi.bar = scr.add(new ProgressBar(30, 175, 180, 20, COLOR_WHITE, TFT_BLACK));
+    splashUi.percent = scr.add(new ValueField(120, 204, 50, 18, 2, COLOR_WHITE, TFT_BLACK, "%"));
+    splashUi.status = scr.add(new Label(120, 228, 200, 15, "", 1, COLOR_CYAN, TFT_BLACK));
+}
+
 void WatchUICLASS::drawSplashScreen(const char* status, int progress) {
-    TFT_eSPI *tft = ttgo->tft;
+    UICanvas *tft = &canvas;
+    syncPanel();
+    
+    if (!splashUi.screen.isBuilt()) {
+        buildSplashScreen();
+    }
     
-    // 첫 호출 시 배경 그리기
+    // 첫 호출 시 배경 지우고 전체 위젯 다시 그림
     static bool splashInit = false;
     if (!splashInit || progress <= 10) {
         tft->fillScreen(TFT_BLACK);
+        splashUi.screen.invalidateAll();
         splashInit = true;
-        
-        // 🔲 상단 로고 박스
-        tft->drawRect(40, 30, 160, 70, COLOR_CYAN);
-        tft->drawRect(42, 32, 156, 66, COLOR_CYAN);
-        
-        // 📝 TTGO WATCH 텍스트
-        tft->setTextDatum(MC_DATUM);
-        tft->setFreeFont(&DSEG7_Classic_Regular_28);
-        tft->setTextColor(COLOR_WHITE, TFT_BLACK);
-        tft->drawString("RAG", 120, 50);
-        
-        tft->setFreeFont(&DSEG7_Modern_Bold_20);
-        tft->setTextColor(COLOR_CYAN, TFT_BLACK);
-        tft->drawString("WATCH", 120, 80);
-        tft->setFreeFont(NULL);
-        
-        // 🏢 회사명
-        tft->setTextFont(2);
-        tft->setTextColor(COLOR_ORANGE, TFT_BLACK);
-        tft->drawString("FTH-KOREA.co", 120, 120);
-        
-        // 📦 버전 정보
-        tft->setTextFont(1);
-        tft->setTextColor(COLOR_GRAY1, TFT_BLACK);
-        tft->drawString("Version 2.5 - NTP Support", 120, 145);
-        
-        // 프로그레스 바 테두리
-        tft->drawRect(30, 175, 180, 20, COLOR_WHITE);
     }
     
-    // 📊 프로그레스 바 업데이트
-    int barWidth = (progress * 176) / 100;
-    
     // 프로그레스 바 색상 (진행도에 따라)
     uint16_t barColor;
     if (progress < 30) {
@@ -207,22 +311,14 @@ void WatchUICLASS::drawSplashScreen(const char* status, int progress) {
         barColor = COLOR_GREEN;
     }
     
-    // 이전 바 지우고 새로 그리기
-    tft->fillRect(32, 177, 176, 16, TFT_BLACK);
-    tft->fillRect(32, 177, barWidth, 16, barColor);
-    
-    // 퍼센트 표시
-    tft->setTextDatum(MC_DATUM);
-    tft->setTextFont(2);
-    tft->setTextColor(COLOR_WHITE, TFT_BLACK);
-    tft->fillRect(95, 195, 50, 18, TFT_BLACK);  // 이전 텍스트 지우기
-    tft->drawString(String(progress) + "%", 120, 205);
+    // 📊 바뀐 위젯만 다시 그림
+    splashUi.bar->setValue(progress, barColor);
+    splashUi.percent->setValue(progress);
+    splashUi.status->setText(status);
+    splashUi.screen.render(tft);
     
-    // 📝 상태 메시지
-    tft->setTextFont(1);
-    tft->setTextColor(COLOR_CYAN, TFT_BLACK);
-    tft->fillRect(20, 220, 200, 15, TFT_BLACK);  // 이전 상태 지우기
-    tft->drawString(status, 120, 228);
+    // 🆕 updateUI 밖에서 호출되므로 직접 flush
+    flushFrame();
     
     // 스플래시 끝나면 플래그 리셋
     if (progress >= 100) {
@@ -236,6 +332,7 @@ void WatchUICLASS::goToSleep() {
     // WiFi 확실히 끄기
     disconnectWiFi();
     
+    syncPanel();
     ttgo->closeBL();
     ttgo->displaySleep();
     ttgo->powerOff();
@@ -409,9 +506,28 @@ void WatchUICLASS::setupDisplay() {
         return;
     }
     
-    ttgo->tft->setTextDatum(MC_DATUM);
+    canvas.setTextDatum(MC_DATUM);
     initCoordinates();
     
+    // 🆕 베젤 라벨을 한 번만 래스터화 (매초 폰트 디코딩 제거)
+    bezel.build(ttgo->tft, clockNumbers, start, startP,
+                x, y, px, py, lx, ly, COLOR_WHITE, COLOR_BLACK);
+    
+    // 🆕 DSEG7 숫자는 바뀐 세그먼트만 칠함
+    secDigits.begin(&DSEG7_Modern_Bold_20, sx, sy - 36);      // @glyphs 0123456789
+    timeDigits.begin(&DSEG7_Classic_Regular_28, sx, sy + 28);  // @glyphs 0123456789:
+#ifdef USE_AA_DIGITS
+    // 🆕 바뀐 자리는 AA 칸 통째로 (fonts.h의 생성 글리프)
+    secDigits.setSmoothFont(&DSEG7_Modern_Bold_20AA);
+    timeDigits.setSmoothFont(&DSEG7_Classic_Regular_28AA);
+#endif
+    
+    // 🆕 궤도 점: 반시계 방향, 프레임 속도와 무관한 각속도
+    orbit.begin(&animClock, rAngle, -ORBIT_DEG_PER_SEC);
+    
+    pacer.begin(framePeriodFor(currentState));
+    ambientPanel.begin(ttgo->tft, ttgo->tft->getRotation());
+    
     displayInitialized = true;
     firstDraw = true;
     _PL("Display setup complete");
@@ -545,9 +661,21 @@ void WatchUICLASS::checkStatus() {
     
     if (touch.isPressed) {
         lastActivityTime = currentTime;
+        lastInputTime = currentTime;
+        
+        // 🆕 상시 표시 중 터치 → 시계로 복귀 (이번 터치는 탭으로 세지 않음)
+        if (currentState == AppState::AMBIENT) {
+            exitAmbient();
+            return;
+        }
         setBrightness(FULL_BRIGHTNESS);
     }
     
+    // 🆕 누르는 중/뗀 직전 프레임은 최대 속도 (탭 판정)
+    if (touch.isPressed || touch.wasPressed) {
+        governor.notifyEvent();
+    }
+    
     if (irq) {
         handleIRQ();
     }
@@ -562,40 +690,57 @@ void WatchUICLASS::checkStatus() {
             break;
             
         case AppState::MENU:
+            // 🆕 목록 위 드래그는 스크롤 (떼는 순간을 탭으로 세지 않음)
+            menuList.onTouch(touch.isPressed, touch.wasPressed, touch.y);
+            if (menuList.wasDragged()) {
+                break;
+            }
+            
             if (detectDoubleTap()) {
                 _PL("Double tap - Clock");
                 switchToState(AppState::CLOCK);
             } else if (detectSingleTap()) {
-                // 메뉴 항목 선택 (Y 좌표 기준)
-                if (touch.y >= 55 && touch.y < 90) {
-                    _PL("NTP Sync Selected");
-                    switchToState(AppState::NTP_SYNC);
-                    return;
-                } else if (touch.y >= 90 && touch.y < 125) {
-                    _PL("Battery Info Selected");
-                    switchToState(AppState::BATTERY_INFO);
-                    return;
-                } else if (touch.y >= 125 && touch.y < 160) {
-                    _PL("Settings Selected");
-                    return;
-                } else if (touch.y >= 160 && touch.y < 195) {
-                    _PL("Exit Selected");
-                    switchToState(AppState::CLOCK);
-                    return;
+                // 메뉴 항목 선택 (스크롤 위치 반영)
+                switch (menuList.itemAt(touch.y)) {
+                    case 0:
+                        _PL("NTP Sync Selected");
+                        switchToState(AppState::NTP_SYNC);
+                        return;
+                    case 1:
+                        _PL("Battery Info Selected");
+                        switchToState(AppState::BATTERY_INFO);
+                        return;
+                    case 2:
+                        _PL("Settings Selected");
+                        return;
+                    case 3:
+                        _PL("Watch Face Selected");
+                        toggleWatchFace();
+                        return;
+                    case 4:
+                        _PL("Sleep Selected");
+                        goToSleep();
+                        return;
+                    case 5:
+                        _PL("Exit Selected");
+                        switchToState(AppState::CLOCK);
+                        return;
+                    default:
+                        break;
                 }
             }
             break;
             
         case AppState::NTP_SYNC:
             if (detectSingleTap()) {
-                // 동기화 버튼 영역 (Y: 130~180)
-                if (touch.y >= 130 && touch.y < 180) {
+                // 🆕 위젯 영역으로 판정 (동기화 버튼 / 아래쪽 뒤로가기 띠, 화면을 그린 뒤에만)
+                bool built = ntpUi.screen.isBuilt();
+                if (built && ntpUi.sync->contains(touch.x, touch.y)) {
                     _PL("Starting NTP Sync...");
                     firstDraw = true;  // 화면 갱신
                     performNtpSync();
                     firstDraw = true;  // 결과 표시
-                } else if (touch.y >= 200) {
-                    // 뒤로가기
+                } else if (built && ntpUi.back->contains(touch.x, touch.y)) {
                     switchToState(AppState::MENU);
                     return;
                 }
@@ -616,6 +761,25 @@ void WatchUICLASS::checkStatus() {
             break;
     }
     
+#ifdef USE_AMBIENT_MODE
+    // 🆕 deep sleep 대신 저전력 상시 표시 (버튼/터치로 바로 복귀)
+    unsigned long inputIdle = currentTime - lastInputTime;
+    if (currentState == AppState::AMBIENT) {
+        if (inputIdle > (unsigned long)AMBIENT_TIMEOUT + AMBIENT_SLEEP_TIME) {
+            // 🆕 오래 방치되면 기존처럼 deep sleep
+            //    (light sleep은 LEDC가 APB 클럭이라 백라이트 PWM이 멈춤 → 사용 안 함)
+            ambientPanel.exit();
+            goToSleep();
+        }
+    } else if (inputIdle > (unsigned long)AMBIENT_TIMEOUT) {
+        enterAmbient();
+    } else if (inputIdle > (unsigned long)(sleepTimeout / 2)) {
+        // ✅ 진입 전 단계는 기존처럼 어둡게 (FrameMode::DIMMED)
+        if (brightness > DIM_BRIGHTNESS) {
+            setBrightness(DIM_BRIGHTNESS);
+        }
+    }
+#else
     unsigned long idleTime = currentTime - lastActivityTime;
     
     if (idleTime > (unsigned long)sleepTimeout) {
@@ -625,6 +789,7 @@ void WatchUICLASS::checkStatus() {
             setBrightness(DIM_BRIGHTNESS);
         }
     }
+#endif
 }
 
 void WatchUICLASS::handleIRQ() {
@@ -636,7 +801,13 @@ void WatchUICLASS::handleIRQ() {
         if (power->isPEKShortPressIRQ()) {
             _PL("Button press");
             lastActivityTime = millis();
-            setBrightness(FULL_BRIGHTNESS);
+            lastInputTime = lastActivityTime;
+            if (currentState == AppState::AMBIENT) {
+                exitAmbient();
+            } else {
+                setBrightness(FULL_BRIGHTNESS);
+                governor.notifyEvent();
+            }
         }
         
         power->clearIRQ();
@@ -644,14 +815,44 @@ void WatchUICLASS::handleIRQ() {
 }
 
 void WatchUICLASS::switchToState(AppState newState) {
+    AppState oldState = currentState;
     currentState = newState;
     lastActivityTime = millis();
+    lastInputTime = lastActivityTime;
+    governor.notifyEvent();   // 🆕 새 화면은 바로 그림
+    
+    syncPanel();
+    canvas.resetList();   // 🆕 화면이 통째로 바뀜 → 다음 프레임은 기록한 op 전부 실행
+    menuList.end();       // 🆕 세로 스크롤 해제 (새 화면은 전체 push)
+#ifdef USE_SPRITE_COMPOSITOR
+#ifdef USE_SPECULATIVE_RENDER
+    spec.discard();       // 🆕 미리 그린 프레임은 이전 화면 기준
+#endif
+    // 🆕 떠나는 화면을 저장하고, 목적지 스냅샷이 있으면 복원
+    //    → 검정 화면 없이 다음 프레임에 전체 push 한 번 + 바뀐 위젯만 갱신
+    if (oldState != newState) {
+        saveScreen(oldState);
+    }
+    if (restoreScreen(newState)) {
+        _PP("State (cached): ");
+        _PL((int)newState);
+        return;
+    }
     
-    ttgo->tft->fillScreen(TFT_BLACK);
+    // 🆕 밴드 모드: 패널 전체를 DMA로 지우고 해시 리셋
+    if (compositor.isBanded()) {
+        compositor.fillPanel(TFT_BLACK);
+    } else
+#endif
+    canvas.fillScreen(TFT_BLACK);
     firstDraw = true;
     
     _PP("State: ");
     _PL((int)newState);
+    
+    // 🆕 시계 상태는 시계를 새로 그릴 때만 리셋 (메뉴/상시 표시 진입 시 유지 → 시계 스냅샷과 일치)
+    if (isStaticScreen(newState) || newState == AppState::AMBIENT) return;
+    
     // 🔧 모든 prev 변수 리셋 추가!
     prevSec = "";
     prevMin = "";
@@ -662,15 +863,81 @@ void WatchUICLASS::switchToState(AppState newState) {
     prevBrightness = -1;
 }
 
+#ifdef USE_SPRITE_COMPOSITOR
+// ============================================
+// 🆕 Screen Cache
+// ============================================
+int8_t WatchUICLASS::cacheSlotFor(AppState state) const {
+    switch (state) {
+        case AppState::CLOCK:        return 0;
+        case AppState::MENU:         return 1;
+        case AppState::BATTERY_INFO: return 2;
+        case AppState::NTP_SYNC:     return 3;
+        default:                     return -1;
+    }
+}
+
+// 시계 화면의 날짜/요일/NTP 아이콘은 firstDraw 때만 그림 → 바뀌면 스냅샷 무효
+uint32_t WatchUICLASS::cacheTagFor(AppState state) {
+    if (state != AppState::CLOCK) return 0;
+    
+    RTC_Date now = ttgo->rtc->getDateTime();
+    return ((uint32_t)now.year << 16) | (now.month << 8) | (now.day << 1) |
+           (analogFace ? 0x40 : 0) | (ntpSyncedToday ? 1 : 0);
+}
+
+void WatchUICLASS::saveScreen(AppState state) {
+    int8_t slot = cacheSlotFor(state);
+    if (slot < 0 || !screens.isEnabled()) return;
+    
+    // 아직 한 번도 그려지지 않은 화면은 저장하지 않음
+    if (firstDraw) {
+        screens.drop(slot);
+        return;
+    }
+    screens.capture(slot, (const uint16_t *)compositor.frame()->getPointer(), cacheTagFor(state));
+}
+
+bool WatchUICLASS::restoreScreen(AppState state) {
+    int8_t slot = cacheSlotFor(state);
+    if (slot < 0 || !screens.isEnabled()) return false;
+    
+    unsigned long t0 = micros();
+    if (!screens.restore(slot, (uint16_t *)compositor.frame()->getPointer(), cacheTagFor(state))) {
+        return false;
+    }
+    
+    damage.addAll();
+    firstDraw = false;
+    _PF("Screen cache: slot %d restored in %lu us (%lu hits / %lu misses)\n",
+        slot, micros() - t0,
+        (unsigned long)screens.getHits(), (unsigned long)screens.getMisses());
+    return true;
+}
+#endif
+
 // ============================================
 // UI Update
 // ============================================
 void WatchUICLASS::updateUI() {
     lastActivityTime = millis();
+    
+    // 🆕 정적 화면은 이벤트가 있을 때만 그림
+    governor.update(isStaticScreen(currentState), brightness <= DIM_BRIGHTNESS,
+                    framePeriodFor(currentState), ambientPeriodMs());
+    if (displayInitialized && !governor.shouldRender()) {
+        return;
+    }
+    
+    syncPanel();   // 🆕 이전 프레임의 DMA 완료 후 그리기 시작
+    animClock.tick();
     if (!displayInitialized) {
         setupDisplay();
     }
     
+    // 🆕 그리기 호출은 기록만 → flushFrame에서 이전 프레임과 다른 op만 실행
+    canvas.beginList();
+    
     switch (currentState) {
         case AppState::CLOCK:
             drawClockFace();
@@ -684,83 +951,494 @@ void WatchUICLASS::updateUI() {
         case AppState::NTP_SYNC:
             drawNtpSyncScreen();
             break;
+        case AppState::AMBIENT:
+            drawAmbientFace();
+            break;
         default:
             drawClockFace();
             break;
     }
+    
+    flushFrame();
+    
+#ifdef USE_SPRITE_COMPOSITOR
+#ifdef USE_SPECULATIVE_RENDER
+    // 🆕 push 직후 남는 시간에 다음 초를 미리 그림
+    if (currentState == AppState::CLOCK) {
+        speculateNextSecond();
+    }
+#endif
+#endif
     lastActivityTime = millis();
 }
 
+// ============================================
+// 🆕 Frame Pacing
+// ============================================
+uint32_t WatchUICLASS::framePeriodFor(AppState state) const {
+    switch (state) {
+#ifdef BEZEL_SMOOTH
+        case AppState::CLOCK:        return FRAME_MS_SMOOTH;
+#else
+        case AppState::CLOCK:        return FRAME_MS_CLOCK;
+#endif
+        case AppState::MENU:         return FRAME_MS_MENU;
+        case AppState::BATTERY_INFO: return FRAME_MS_BATTERY;
+        case AppState::NTP_SYNC:     return FRAME_MS_NTP;
+        default:                     return FRAME_MS_CLOCK;
+    }
+}
+
+// 메뉴/배터리/NTP 화면은 firstDraw 또는 터치 처리 때만 내용이 바뀜
+bool WatchUICLASS::isStaticScreen(AppState state) const {
+    return state == AppState::MENU ||
+           state == AppState::BATTERY_INFO ||
+           state == AppState::NTP_SYNC;
+}
+
+void WatchUICLASS::waitNextFrame() {
+    pacer.setPeriod(governor.getPeriodMs());
+    
+#ifdef PACER_LIGHT_SLEEP
+    syncPanel();   // light sleep 중에는 SPI DMA가 멈춤
+#endif
+    pacer.wait();
+    
+    if (millis() - lastPacerLog >= 10 * SECOND) {
+        _PF("Pacer: %u ms, %lu frames, %lu missed, %lu wakeups, max work %lu us, busy %u%%\n",
+            pacer.getPeriod(),
+            (unsigned long)pacer.getFrames(),
+            (unsigned long)pacer.getMissed(),
+            (unsigned long)pacer.getWakeups(),
+            (unsigned long)pacer.getMaxWorkUs(),
+            pacer.getBusyPercent());
+        _PF("Frame time: p50 %lu us, p90 %lu us, p99 %lu us\n",
+            (unsigned long)pacer.getPercentileUs(50),
+            (unsigned long)pacer.getPercentileUs(90),
+            (unsigned long)pacer.getPercentileUs(99));
+        _PF("Governor: %s, %lu drawn / %lu skipped, %lu switches\n",
+            FrameGovernor::modeName(governor.getMode()),
+            (unsigned long)governor.getRendered(),
+            (unsigned long)governor.getSkipped(),
+            (unsigned long)governor.getSwitches());
+        _PF("SPI batch: %s, %lu transactions saved, %lu fills merged\n",
+            canvas.isBatching() ? "on" : "off",
+            (unsigned long)canvas.getSavedTransactions(),
+            (unsigned long)canvas.getMergedFills());
+#ifdef USE_SPRITE_COMPOSITOR
+#ifdef USE_SPECULATIVE_RENDER
+        _PF("Speculation: %lu hits / %lu misses, prepare %lu us, commit %lu us\n",
+            (unsigned long)spec.getHits(),
+            (unsigned long)spec.getMisses(),
+            (unsigned long)spec.getLastPrepareUs(),
+            (unsigned long)spec.getLastCommitUs());
+        spec.resetStats();
+#endif
+#endif
+        pacer.resetStats();
+        governor.resetStats();
+        canvas.resetBatchStats();
+        lastPacerLog = millis();
+    }
+}
+
+// ============================================
+// 🆕 Ambient Mode
+// ============================================
+void WatchUICLASS::enterAmbient() {
+    _PL("Entering ambient mode");
+    switchToState(AppState::AMBIENT);
+    setBrightness(AMBIENT_BRIGHTNESS);
+    
+    // 시:분 숫자 띠만 켜 둠 (나머지 행은 패널이 구동하지 않음)
+    syncPanel();
+    ambientPanel.enter(timeDigits.getTop() - 2, timeDigits.getBottom() + 2);
+    
+    // 분당 1프레임 → 대기 시간 대부분을 낮은 클럭으로
+    savedCpuMhz = getCpuFrequencyMhz();
+    setCpuFrequencyMhz(AMBIENT_CPU_MHZ);
+}
+
+void WatchUICLASS::exitAmbient() {
+    if (savedCpuMhz > 0) {
+        setCpuFrequencyMhz(savedCpuMhz);
+        savedCpuMhz = 0;
+    }
+    
+    syncPanel();
+    ambientPanel.exit();
+    setBrightness(FULL_BRIGHTNESS);
+    switchToState(AppState::CLOCK);
+    _PF("Ambient: %lu entries, last %lu s\n",
+        (unsigned long)ambientPanel.getEntries(),
+        (unsigned long)ambientPanel.getLastDurationSec());
+}
+
+// 상시 표시 중이면 다음 분까지 남은 시간 (RTC 기준), 아니면 0
+uint32_t WatchUICLASS::ambientPeriodMs() {
+    if (currentState != AppState::AMBIENT) return 0;
+    
+    RTC_Date now = ttgo->rtc->getDateTime();
+    return (60 - now.second) * 1000UL + AMBIENT_WAKE_MARGIN_MS;
+}
+
+// 🆕 이번 프레임의 손상 영역만 패널로 push
+void WatchUICLASS::flushFrame() {
+    canvas.endList();
+    
+#ifdef USE_SPRITE_COMPOSITOR
+    if (!compositor.isBanded()) {
+        compositor.present(damage);
+        damage.endFrame();
+        logFrameStats();
+        return;
+    }
+#endif
+    damage.endFrame();
+}
+
+// 🆕 진행 중인 DMA 전송 마무리 (패널에 직접 그리기 전 호출)
+void WatchUICLASS::syncPanel() {
+#ifdef USE_SPRITE_COMPOSITOR
+    compositor.sync();
+#endif
+}
+
+void WatchUICLASS::logFrameStats() {
+    if (millis() - lastStatsLog < SECOND) return;
+    
+#ifdef USE_SPRITE_COMPOSITOR
+    if (compositor.getLastPushBytes() == 0) return;
+    
+    _PF("Frame: damage %ld px / %u rects, push %u bytes / %u spans / %u DMA bands\n",
+        (long)damage.getLastArea(),
+        damage.getLastCount(),
+        compositor.getLastPushBytes(),
+        compositor.getLastSpanCount(),
+        compositor.getLastDmaBands());
+    if (compositor.isPaletted()) {
+        _PF("Palette: %u/%d colors, %lu reclaims\n",
+            compositor.palette()->getUsed(), PALETTE_SIZE,
+            (unsigned long)compositor.palette()->getReclaims());
+    }
+#endif
+    
+    _PF("Display list: %u ops recorded / %u emitted\n",
+        canvas.getLastRecorded(), canvas.getLastEmitted());
+    _PF("Glyph cache: %u/%d slots, %lu hits / %lu misses / %lu evictions\n",
+        glyphs.getUsedSlots(), GLYPH_CACHE_SLOTS,
+        (unsigned long)glyphs.getHits(),
+        (unsigned long)glyphs.getMisses(),
+        (unsigned long)glyphs.getEvictions());
+    _PF("Text metrics: %u/%d slots, %lu hits / %lu misses / %lu evictions\n",
+        metrics.getUsedSlots(), TEXT_METRICS_SLOTS,
+        (unsigned long)metrics.getHits(),
+        (unsigned long)metrics.getMisses(),
+        (unsigned long)metrics.getEvictions());
+#ifdef USE_HANGUL_TEXT
+    if (hangul.isReady()) {
+        _PF("Glyph store: %u/%d slots, %u%% hit rate (%lu hits / %lu misses / %lu evictions)\n",
+            hangul.getUsedSlots(), GLYPH_STORE_SLOTS, hangul.getHitRate(),
+            (unsigned long)hangul.getHits(),
+            (unsigned long)hangul.getMisses(),
+            (unsigned long)hangul.getEvictions());
+    }
+#endif
+    lastStatsLog = millis();
+}
+
+// ============================================
+// 🆕 Ambient Face - 시:분만 (베젤/궤도 점/초 없음)
+// ============================================
+void WatchUICLASS::drawAmbientFace() {
+    if (firstDraw) {
+        ambientTime = "";   // switchToState에서 화면이 비워짐
+        firstDraw = false;
+    }
+    
+    String currentTime = String(ttgo->rtc->formatDateTime());
+    String hhmm = currentTime.substring(0, 5);
+    if (hhmm == ambientTime) return;
+    
+    timeDigits.draw(&canvas, ambientTime, hhmm, COLOR_WHITE, COLOR_BLACK);
+    canvas.setTextFont(0);
+    ambientTime = hhmm;
+}
+
 // ============================================
 // Clock Face - 부분 업데이트
 // ============================================
 void WatchUICLASS::drawClockFace() {
-    TFT_eSPI *tft = ttgo->tft;
+#ifdef USE_SPRITE_COMPOSITOR
+    if (analogFace) {
+        drawAnalogFace();
+        return;
+    }
+#endif
+    
+    ClockFrame t;
+    readClockFrame(t);
+    
+    // 점 색각 변환 애니메이션
+    // 🆕 분이 바뀌면 랜덤 색상 적용
+    int currentMinute = t.minStr.toInt();
+    if (currentMinute != lastMinute) {
+        lastMinute = currentMinute;
+        circleColor = getRandomColor();
+        _PL("New minute! Color changed.");
+    }
+    
+    // 빨간 점 애니메이션 - 🆕 경과 시간 기준 (지연된 프레임은 건너뜀)
+    rAngle = orbit.angle();
+    
+#ifdef USE_SPRITE_COMPOSITOR
+    // 🆕 밴드 모드: 밴드마다 전체를 다시 그린 뒤 변경분만 push
+    if (compositor.isBanded()) {
+        compositor.compose([&](TFT_eSPI *gfx, bool repaint) {
+            UICanvas band(gfx);
+            band.setGlyphCache(canvas.getGlyphCache());
+            band.setMetricsCache(canvas.getMetricsCache());
+            renderClockFace(&band, t, repaint);
+        });
+        logFrameStats();
+        return;
+    }
+    
+#ifdef USE_SPECULATIVE_RENDER
+    // 🆕 초가 바뀌었고 미리 그린 프레임이 맞으면 복사 → 아래는 궤도 점만 그림
+    commitSpeculation(t);
+    lastClock = t;
+#endif
+#endif
+    
+    // 백버퍼(또는 패널)에 부분 업데이트 → updateUI에서 flush
+    renderClockFace(&canvas, t, false);
+}
+
+// ============================================
+// 🆕 Watch Face Selection
+// ============================================
+// 아날로그 면은 16bpp 전체 프레임 + PSRAM 배경이 필요 (밴드/4bpp 모드는 디지털만)
+void WatchUICLASS::toggleWatchFace() {
+#ifdef USE_SPRITE_COMPOSITOR
+    if (analogFace) {
+        analogFace = false;
+    } else if (compositor.isReady() && !compositor.isBanded() && !compositor.isPaletted() &&
+               analog.begin(ttgo->tft)) {
+        analogFace = true;
+    }
+    _PF("Watch face: %s\n", analogFace ? "analog" : "digital");
+#else
+    _PL("Watch face: analog needs USE_SPRITE_COMPOSITOR");
+#endif
+    switchToState(AppState::CLOCK);
+}
+
+#ifdef USE_SPRITE_COMPOSITOR
+// 🆕 움직인 바늘의 경계 사각형만 배경에서 복원 → 바늘 합성 (canvas 기록 없음)
+void WatchUICLASS::drawAnalogFace() {
+    RTC_Date now = ttgo->rtc->getDateTime();
+    
+    analog.draw(compositor.frame(), &damage, now.hour, now.minute, now.second,
+                msIntoSecond(now.second), firstDraw);
+    firstDraw = false;
+}
+
+#ifdef USE_SPECULATIVE_RENDER
+// ============================================
+// 🆕 Speculative Render - 다음 초를 미리 그림
+// ============================================
+// RTC는 폴링으로만 읽히므로 초 경계를 보는 시점은 그대로 (프레임 주기 이내),
+// 대신 경계 프레임의 일이 렌더링 → 사각형 복사 + push로 줄어듦
+void WatchUICLASS::speculateNextSecond() {
+#ifndef BEZEL_SMOOTH
+    if (!spec.isReady() || spec.isArmed() || firstDraw || analogFace) return;
+    if (compositor.isBanded() || compositor.isPaletted()) return;
+    if (lastClock.sec.length() == 0 || prevSec != lastClock.sec) return;
+    if (msIntoSecond(rtcSecond) < SPEC_LEAD_MS) return;
+    
+    int s = lastClock.sec.toInt() + 1;
+    int m = lastClock.minStr.toInt();
+    int h = lastClock.hr.toInt();
+    if (s == 60) { s = 0; m++; }
+    if (m == 60) { m = 0; h++; }
+    if (h == 24) return;   // 날짜가 바뀜 → 예측하지 않음
+    
+    specClock = lastClock;
+    specClock.sec = twoDigits(s);
+    specClock.minStr = twoDigits(m);
+    specClock.hr = twoDigits(h);
+    
+    UICanvas *tft = spec.prepare(compositor.frame());
+    if (tft == nullptr) return;
+    
+    // 사본의 궤도 점은 지움 (경계 프레임에서 현재 위치에 다시 그림)
+    if (prevRAngle >= 0) {
+        tft->fillCircle((int)px[prevRAngle], (int)py[prevRAngle], 7, COLOR_BLACK);
+    }
+    
+    specBase = saveStatics();
+    speculating = true;
+    renderClockFace(tft, specClock, false);
+    speculating = false;
+    specAfter = saveStatics();
+    loadStatics(specBase);
+    
+    spec.arm();
+#endif
+}
+
+void WatchUICLASS::commitSpeculation(const ClockFrame &t) {
+    if (!spec.isArmed()) return;
+    
+    // 그 사이에 밝기/배터리 표시가 바뀌었으면 사본의 바탕이 달라짐
+    if (!sameStatics(saveStatics(), specBase)) {
+        spec.discard();
+        return;
+    }
+    if (t.sec == specBase.sec) return;   // 아직 같은 초
     
+    if (t.sec != specClock.sec || t.minStr != specClock.minStr || t.hr != specClock.hr) {
+        spec.discard();
+        return;
+    }
+    
+    spec.commit(compositor.frame(), &damage);
+    loadStatics(specAfter);
+    canvas.resetList();   // 복사한 사각형이 지난 프레임의 op(궤도 점)를 덮었을 수 있음
+}
+#endif
+#endif
+
+void WatchUICLASS::readClockFrame(ClockFrame &t) {
     String currentTime = String(ttgo->rtc->formatDateTime());
     String dateStr = String(ttgo->rtc->formatDateTime(PCF_TIMEFORMAT_DD_MM_YYYY));
     
-    String sec = currentTime.substring(6, 8);
-    String minStr = currentTime.substring(3, 5);
-    String hr = currentTime.substring(0, 2);
+    t.sec = currentTime.substring(6, 8);
+    t.minStr = currentTime.substring(3, 5);
+    t.hr = currentTime.substring(0, 2);
+    
+    t.d1 = dateStr.substring(0, 1);
+    t.d2 = dateStr.substring(1, 2);
+    t.m1 = dateStr.substring(3, 4);
+    t.m2 = dateStr.substring(4, 5);
+    
+    t.day = dateStr.substring(0, 2).toInt();
+    t.month = dateStr.substring(3, 5).toInt();
+    t.year = dateStr.substring(6, 10).toInt();
+    
+    t.battPct = (int)getBatteryPercentage();
+    t.secMs = msIntoSecond(t.sec.toInt());
+}
+
+// 🆕 RTC는 초 단위 → 초가 바뀐 것을 본 시각부터 millis로 보간 (0..999)
+uint16_t WatchUICLASS::msIntoSecond(int second) {
+    if (second != rtcSecond) {
+        rtcSecond = second;
+        rtcSecondStart = millis();
+    }
+    return min(millis() - rtcSecondStart, 999UL);
+}
+
+// 🆕 날짜/요일/초/시간처럼 바뀌는 값을 뺀 시계의 고정 요소 (검정 배경 위)
+void WatchUICLASS::drawClockStatics(UICanvas *tft) {
+    tft->drawCircle(sx, sy, 124, COLOR_GRAY1);
+    
+    tft->fillRect(70, 86, 12, 20, color3);
+    tft->fillRect(84, 86, 12, 20, color3);
+    tft->fillRect(150, 86, 12, 20, color3);
+    tft->fillRect(164, 86, 12, 20, color3);
+    
+    tft->setTextDatum(MC_DATUM);
+    tft->setTextColor(COLOR_CYAN, COLOR_BLACK);
+    tft->drawString("MONTH", 84, 78);
+    tft->drawString("DAY", 162, 78);
+    
+    tft->setTextColor(COLOR_ORANGE, COLOR_BLACK);
+    tft->drawString("System Control", 120, 174);
+    tft->drawString("***", 120, 104);
+    
+    tft->fillTriangle(sx - 1, sy - 70, sx - 5, sy - 56, sx + 4, sy - 56, COLOR_ORANGE);
+    
+    tft->drawRect(186, 8, 36, 14, COLOR_CYAN);
+    tft->fillRect(222, 12, 4, 6, COLOR_CYAN);
     
-    String d1 = dateStr.substring(0, 1);
-    String d2 = dateStr.substring(1, 2);
-    String m1 = dateStr.substring(3, 4);
-    String m2 = dateStr.substring(4, 5);
+    tft->setTextColor(COLOR_WHITE, COLOR_BLACK);
+    tft->drawString("FTH-KOREA.co", 120, 120, 2);
     
-    int day = dateStr.substring(0, 2).toInt();
-    int month = dateStr.substring(3, 5).toInt();
-    int year = dateStr.substring(6, 10).toInt();
+    // ✅ NTP 동기화 상태 아이콘
+    if (ntpSyncedToday) {
+        tft->fillCircle(10, 230, 4, COLOR_GREEN);  // 녹색 = 동기화됨
+    } else {
+        tft->fillCircle(10, 230, 4, COLOR_ORANGE); // 주황 = 미동기화
+    }
+}
+
+#ifdef USE_CLOCK_BACKGROUND
+// 🆕 처음 한 번 생성 (NTP 아이콘 색이 바뀌면 다시), 이후엔 push만
+bool WatchUICLASS::drawClockBackground(UICanvas *tft) {
+    if (clockBgFailed) return false;
+    
+    uint32_t tag = ntpSyncedToday ? 1 : 0;
+    if (!clockBg.matches(tag) &&
+        !clockBg.build(ttgo->tft, [this](UICanvas *bg) { drawClockStatics(bg); }, COLOR_BLACK, tag)) {
+        clockBgFailed = true;
+        return false;
+    }
     
-    int newAngle = sec.toInt() * 6;
+    clockBg.draw(tft);
+    return true;
+}
+#endif
+
+// repaint == true: 대상이 이미 비워져 있음 (밴드 합성) → 지우기 없이 전부 그림
+void WatchUICLASS::renderClockFace(UICanvas *tft, const ClockFrame &t, bool repaint) {
+#ifdef BEZEL_SMOOTH
+    // 🆕 초 + 경과 ms로 1도씩 회전 (베젤 좌표 테이블이 1도 간격)
+    int newAngle = (t.sec.toInt() * 6 + t.secMs * 6 / 1000) % 360;
+#else
+    int newAngle = t.sec.toInt() * 6;
     if (newAngle >= 360) newAngle = 0;
+#endif
+    
+    if (repaint) {
+        prevAngle = -1;
+        prevRAngle = -1;
+    }
     
     // 첫 번째 그리기
-    if (firstDraw) {
-        tft->fillScreen(TFT_BLACK);
-        
-        tft->drawCircle(sx, sy, 124, COLOR_GRAY1);
-        
-        tft->fillRect(70, 86, 12, 20, color3);
-        tft->fillRect(84, 86, 12, 20, color3);
-        tft->fillRect(150, 86, 12, 20, color3);
-        tft->fillRect(164, 86, 12, 20, color3);
+    if (firstDraw || repaint) {
+        // 🆕 고정 요소: RLE 이미지 push 한 번 (밴드 합성은 밴드마다 전체를 풀어야 해서 기존 방식)
+        bool painted = false;
+#ifdef USE_CLOCK_BACKGROUND
+        painted = !repaint && drawClockBackground(tft);
+#endif
+        if (!painted) {
+            if (!repaint) {
+                tft->fillScreen(TFT_BLACK);
+            }
+            drawClockStatics(tft);
+        }
         
         tft->setTextDatum(MC_DATUM);
-        tft->setTextColor(COLOR_CYAN, COLOR_BLACK);
-        tft->drawString("MONTH", 84, 78);
-        tft->drawString("DAY", 162, 78);
-        
-        tft->setTextColor(COLOR_ORANGE, COLOR_BLACK);
-        tft->drawString("System Control", 120, 174);
-        tft->drawString("***", 120, 104);
-        
-        tft->fillTriangle(sx - 1, sy - 70, sx - 5, sy - 56, sx + 4, sy - 56, COLOR_ORANGE);
-        
-        tft->drawRect(186, 8, 36, 14, COLOR_CYAN);
-        tft->fillRect(222, 12, 4, 6, COLOR_CYAN);
-        
-        tft->setTextSize(2);
-        tft->setTextColor(COLOR_CYAN, COLOR_BLACK);
-        tft->drawString(getWeekday(day, month, year), 30, 15);
-        tft->setTextSize(1);
+#ifdef USE_HANGUL_TEXT
+        if (hangul.isReady()) {
+            hangul.drawString(tft, dayNamesKo[getWeekdayIndex(t.day, t.month, t.year)], 30, 15,
+                              MC_DATUM, COLOR_CYAN, COLOR_BLACK);
+        } else
+#endif
+        {
+            tft->setTextSize(2);
+            tft->setTextColor(COLOR_CYAN, COLOR_BLACK);
+            tft->drawString(getWeekday(t.day, t.month, t.year), 30, 15);
+            tft->setTextSize(1);
+        }
         
         tft->setTextColor(COLOR_WHITE, color3);
-        tft->drawString(m1, 77, 96, 2);
-        tft->drawString(m2, 91, 96, 2);
-        tft->drawString(d1, 157, 96, 2);
-        tft->drawString(d2, 171, 96, 2);
-        
-        tft->setTextColor(COLOR_WHITE, COLOR_BLACK);
-        tft->drawString("FTH-KOREA.co", 120, 120, 2);
-        
-        // ✅ NTP 동기화 상태 아이콘
-        if (ntpSyncedToday) {
-            tft->fillCircle(10, 230, 4, COLOR_GREEN);  // 녹색 = 동기화됨
-        } else {
-            tft->fillCircle(10, 230, 4, COLOR_ORANGE); // 주황 = 미동기화
-        }
+        tft->drawString(t.m1, 77, 96, 2);
+        tft->drawString(t.m2, 91, 96, 2);
+        tft->drawString(t.d1, 157, 96, 2);
+        tft->drawString(t.d2, 171, 96, 2);
         
         firstDraw = false;
         prevAngle = -1;
@@ -769,98 +1447,53 @@ void WatchUICLASS::drawClockFace() {
     
     // 이전 회전 요소 지우기
     if (prevAngle >= 0 && prevAngle != newAngle) {
-        tft->setTextColor(COLOR_BLACK, COLOR_BLACK);
-        for (int i = 0; i < 12; i++) {
-            int idx = (start[i] + prevAngle) % 360;
-            tft->drawString(clockNumbers[i], (int)x[idx], (int)y[idx], 2);
-            tft->drawLine((int)px[idx], (int)py[idx], (int)lx[idx], (int)ly[idx], COLOR_BLACK);
-        }
-        
-        for (int i = 0; i < 60; i++) {
-            int idx = (startP[i] + prevAngle) % 360;
-            tft->fillCircle((int)px[idx], (int)py[idx], 2, COLOR_BLACK);
-        }
+        bezel.erase(tft, prevAngle);
     }
     
     // 이전 빨간 점 지우기
-    if (prevRAngle >= 0 && prevRAngle != rAngle) {
+    if (!speculating && prevRAngle >= 0 && prevRAngle != rAngle) {
         tft->fillCircle((int)px[prevRAngle], (int)py[prevRAngle], 7, COLOR_BLACK);
     }
     
     // 새 회전 요소 그리기
     if (prevAngle != newAngle) {
-        tft->setTextDatum(MC_DATUM);
-        tft->setTextColor(COLOR_WHITE, COLOR_BLACK);
-        for (int i = 0; i < 12; i++) {
-            int idx = (start[i] + newAngle) % 360;
-            tft->drawString(clockNumbers[i], (int)x[idx], (int)y[idx], 2);
-            tft->drawLine((int)px[idx], (int)py[idx], (int)lx[idx], (int)ly[idx], color1);
-        }
-        
-        for (int i = 0; i < 60; i++) {
-            int idx = (startP[i] + newAngle) % 360;
-            tft->fillCircle((int)px[idx], (int)py[idx], 1, color1);
-        }
-        
+        bezel.draw(tft, newAngle, color1);
         prevAngle = newAngle;
     }
     
-    // 점 색각 변환 애니메이션
-    // 🆕 분이 바뀌면 랜덤 색상 적용
-        int currentMinute = minStr.toInt();
-        if (currentMinute != lastMinute) {
-            lastMinute = currentMinute;
-            circleColor = getRandomColor();
-            _PL("New minute! Color changed.");
-        }
-
-        // 빨간 점 애니메이션
-        rAngle -= 2;
-        if (rAngle <= 0) rAngle = 359;
-
+    // 빨간 점 (색상은 분마다 랜덤)
+    if (!speculating) {
         tft->fillCircle((int)px[rAngle], (int)py[rAngle], 6, circleColor);  // 🆕 COLOR_RED → circleColor
         prevRAngle = rAngle;
+    }
     
     // 초 업데이트
-    if (sec != prevSec) {
-        tft->setFreeFont(&DSEG7_Modern_Bold_20);
-        tft->setTextDatum(MC_DATUM);
-        tft->setTextColor(COLOR_BLACK, COLOR_BLACK);
-        if (prevSec.length() > 0) {
-            tft->drawString(prevSec, sx, sy - 36);
-        }
-        
-        tft->setTextColor(COLOR_WHITE, COLOR_BLACK);
-        tft->drawString(sec, sx, sy - 36);
+    if (repaint || t.sec != prevSec) {
+        // 🆕 이전 값과 다른 세그먼트만 켜고 끔 (repaint면 배경이 비어 있음)
+        secDigits.draw(tft, repaint ? String("") : prevSec, t.sec, COLOR_WHITE, COLOR_BLACK);
         tft->setTextFont(0);
-        
-        prevSec = sec;
+        prevSec = t.sec;
     }
     
     // 시:분 업데이트
-    if (hr != prevHr || minStr != prevMin) {
-        String prevTime = prevHr + ":" + prevMin;
-        String newTime = hr + ":" + minStr;
-        
-        tft->setFreeFont(&DSEG7_Classic_Regular_28);
-        tft->setTextDatum(MC_DATUM);
-        
-        if (prevHr.length() > 0) {
-            tft->setTextColor(COLOR_BLACK, COLOR_BLACK);
-            tft->drawString(prevTime, sx, sy + 28);
-        }
+    if (repaint || t.hr != prevHr || t.minStr != prevMin) {
+        String prevTime = (repaint || prevHr.length() == 0) ? String("") : prevHr + ":" + prevMin;
+        String newTime = t.hr + ":" + t.minStr;
         
-        tft->setTextColor(COLOR_WHITE, COLOR_BLACK);
-        tft->drawString(newTime, sx, sy + 28);
+        timeDigits.draw(tft, prevTime, newTime, COLOR_WHITE, COLOR_BLACK);
         tft->setTextFont(0);
         
-        prevHr = hr;
-        prevMin = minStr;
+        prevHr = t.hr;
+        prevMin = t.minStr;
     }
     
     // 배터리 업데이트
-    int battPct = (int)getBatteryPercentage();
-    if (abs(battPct - prevBatteryPct) >= 5 || prevBatteryPct < 0) {
+    int battPct = t.battPct;
+    bool battChanged = abs(battPct - prevBatteryPct) >= 5 || prevBatteryPct < 0;
+    if (repaint && !battChanged) {
+        battPct = prevBatteryPct;   // 밴드마다 같은 값 유지
+    }
+    if (repaint || battChanged) {
         tft->setTextDatum(MC_DATUM);
         tft->setTextSize(2);
         
@@ -875,7 +1508,7 @@ void WatchUICLASS::drawClockFace() {
     }
     
     // 밝기 업데이트
-    if (brightness != prevBrightness) {
+    if (repaint || brightness != prevBrightness) {
         tft->setTextDatum(MC_DATUM);
         tft->setTextSize(2);
         
@@ -892,81 +1525,89 @@ void WatchUICLASS::drawClockFace() {
 // ============================================
 // Menu Screen - NTP 동기화 추가
 // ============================================
-void WatchUICLASS::drawMenuScreen() {
-    if (!firstDraw) return;
-    
-    TFT_eSPI *tft = ttgo->tft;
-    
-    tft->setTextColor(COLOR_WHITE, COLOR_BLACK);
-    tft->setTextDatum(MC_DATUM);
-    tft->setFreeFont(&DSEG7_Classic_Regular_28);
-    tft->drawString("MENU", 120, 25);
-    tft->setFreeFont(NULL);
-    
-    tft->setTextFont(2);
-    
-    const char* menuItems[] = {
-        "1. NTP Sync",       // ✅ 추가
-        "2. Battery Info", 
-        "3. Settings",
-        "4. Exit"
-    };
-    
-    int yPos = 70;
-    for (int i = 0; i < 4; i++) {
+void WatchUICLASS::buildMenuScreen() {
+    WidgetScreen &scr = menuUi.screen;
+    
+    scr.add(new Label(120, 25, "MENU", &DSEG7_Classic_Regular_28, COLOR_WHITE, COLOR_BLACK));
+    
+    // 🆕 항목은 y 55~195 스크롤 창 (35px씩 4개 보임)
+    menuList.begin(ttgo->tft, ttgo->tft->getRotation(), 55, 140, 35, COLOR_BLACK);
+    menuList.setItems(menuItemCount, [this](UICanvas *tft, uint16_t i, int16_t cy) {
+#ifdef USE_HANGUL_TEXT
+        if (hangul.isReady()) {
+            hangul.drawString(tft, menuItemsKo[i], 120, cy, MC_DATUM, COLOR_WHITE, COLOR_BLACK);
+            return;
+        }
+#endif
+        tft->setTextDatum(MC_DATUM);
         tft->setTextColor(COLOR_WHITE, COLOR_BLACK);
-        tft->drawString(menuItems[i], 120, yPos);
-        yPos += 35;
-    }
+        tft->drawString(menuItems[i], 120, cy, 2);
+    });
+    menuList.setMetricsCache(canvas.getMetricsCache());
     
     // NTP 상태 표시
-    tft->setTextColor(COLOR_CYAN, COLOR_BLACK);
-    tft->setTextFont(1);
+    menuUi.syncInfo = scr.add(new Label(120, 200, 220, 10, "", 1, COLOR_CYAN, COLOR_BLACK));
+    scr.add(new Label(120, 220, 0, 0, "Double tap to exit", 1, COLOR_CYAN, COLOR_BLACK));
+}
+
+void WatchUICLASS::drawMenuScreen() {
+    if (!menuUi.screen.isBuilt()) {
+        buildMenuScreen();
+    }
+    if (firstDraw) {
+        menuUi.screen.invalidateAll();
+        menuList.drawAll(&canvas);
+        firstDraw = false;
+    }
+    
+    // 🆕 드래그로 드러난 행만 패널에 직접 (프레임 시작 시 DMA 완료됨)
+    menuList.render();
+    
     if (ntpSyncedToday) {
-        tft->drawString("Last sync: " + getLastSyncTimeStr(), 120, 200);
+        menuUi.syncInfo->setText("Last sync: " + getLastSyncTimeStr());
     } else {
-        tft->drawString("Not synced today", 120, 200);
+        menuUi.syncInfo->setText("Not synced today");
     }
     
-    tft->drawString("Double tap to exit", 120, 220);
-    
-    firstDraw = false;
+    menuUi.screen.render(&canvas);
 }
 
 // ============================================
 // NTP Sync Screen
 // ============================================
-void WatchUICLASS::drawNtpSyncScreen() {
-    TFT_eSPI *tft = ttgo->tft;
+void WatchUICLASS::buildNtpScreen() {
+    WidgetScreen &scr = ntpUi.screen;
     
-    if (firstDraw) {
-        tft->fillScreen(TFT_BLACK);
-        firstDraw = false;
-    }
-    
-    tft->setTextColor(COLOR_WHITE, COLOR_BLACK);
-    tft->setTextDatum(MC_DATUM);
-    tft->setFreeFont(&DSEG7_Classic_Regular_28);
-    tft->drawString("NTP", 120, 25);
-    tft->setFreeFont(NULL);
-    
-    tft->setTextFont(2);
+    scr.add(new Label(120, 25, "NTP", &DSEG7_Classic_Regular_28, COLOR_WHITE, COLOR_BLACK));
     
     // WiFi 정보
-    tft->setTextColor(COLOR_CYAN, COLOR_BLACK);
-    tft->drawString("WiFi:", 50, 60);
-    tft->setTextColor(COLOR_WHITE, COLOR_BLACK);
-    tft->drawString(WIFI_SSID, 150, 60);
+    scr.add(new Label(50, 60, 0, 0, "WiFi:", 2, COLOR_CYAN, COLOR_BLACK));
+    scr.add(new Label(150, 60, 0, 0, WIFI_SSID, 2, COLOR_WHITE, COLOR_BLACK));
     
     // 마지막 동기화
-    tft->setTextColor(COLOR_CYAN, COLOR_BLACK);
-    tft->drawString("Last:", 50, 85);
-    tft->setTextColor(COLOR_WHITE, COLOR_BLACK);
-    tft->drawString(getLastSyncTimeStr(), 150, 85);
+    scr.add(new Label(50, 85, 0, 0, "Last:", 2, COLOR_CYAN, COLOR_BLACK));
+    ntpUi.last = scr.add(new Label(150, 85, 120, 18, "", 2, COLOR_WHITE, COLOR_BLACK));
     
-    // 상태 표시
-    tft->setTextColor(COLOR_CYAN, COLOR_BLACK);
-    tft->drawString("Status:", 50, 110);
+    // 상태 표시 (이전 상태는 140x24 영역으로 지움)
+    scr.add(new Label(50, 110, 0, 0, "Status:", 2, COLOR_CYAN, COLOR_BLACK));
+    ntpUi.status = scr.add(new Label(170, 110, 140, 24, "", 2, COLOR_WHITE, COLOR_BLACK));
+    
+    // Sync 버튼
+    ntpUi.sync = scr.add(new Button(60, 140, 120, 35, "[ SYNC NOW ]", 2, COLOR_CYAN, COLOR_BLACK));
+    
+    // 뒤로가기 (아래쪽 240x40 띠 전체가 터치 영역)
+    scr.add(new Label(120, 190, 0, 0, "Tap button to sync", 1, COLOR_GRAY1, COLOR_BLACK));
+    ntpUi.back = scr.add(new Label(120, 220, 240, 40, "Tap here to go back", 1, COLOR_GRAY1, COLOR_BLACK));
+}
+
+void WatchUICLASS::drawNtpSyncScreen() {
+    if (!ntpUi.screen.isBuilt()) {
+        buildNtpScreen();
+    }
+    if (firstDraw) {
+        ntpUi.screen.invalidateAll();
+        firstDraw = false;
+    }
     
     String statusStr;
     uint16_t statusColor;
@@ -1002,76 +1643,66 @@ void WatchUICLASS::drawNtpSyncScreen() {
             break;
     }
     
-    // 이전 상태 지우기
-    tft->fillRect(100, 100, 140, 25, COLOR_BLACK);
-    tft->setTextColor(statusColor, COLOR_BLACK);
-    tft->drawString(statusStr, 170, 110);
+    // 🆕 바뀐 값만 다시 그림 (매 프레임 전체 그리기 제거)
+    ntpUi.last->setText(getLastSyncTimeStr());
+    ntpUi.status->setText(statusStr);
+    ntpUi.status->setColor(statusColor);
     
-    // Sync 버튼
-    tft->drawRect(60, 140, 120, 35, COLOR_CYAN);
-    tft->setTextColor(COLOR_CYAN, COLOR_BLACK);
-    tft->drawString("[ SYNC NOW ]", 120, 157);
-    
-    // 뒤로가기
-    tft->setTextColor(COLOR_GRAY1, COLOR_BLACK);
-    tft->setTextFont(1);
-    tft->drawString("Tap button to sync", 120, 190);
-    tft->drawString("Tap here to go back", 120, 220);
+    ntpUi.screen.render(&canvas);
 }
 
 // ============================================
 // Battery Info
 // ============================================
-void WatchUICLASS::drawBatteryInfoScreen() {
-    if (!firstDraw) return;
+void WatchUICLASS::buildBatteryScreen() {
+    WidgetScreen &scr = batteryUi.screen;
     
-    TFT_eSPI *tft = ttgo->tft;
+    scr.add(new Label(120, 30, "BATT", &DSEG7_Classic_Regular_28, COLOR_WHITE, COLOR_BLACK));
     
-    float voltage = power->getBattVoltage() / 1000.0;
-    float percentage = getBatteryPercentage();
-    bool isCharging = power->isChargeing();
-    
-    tft->setTextColor(COLOR_WHITE, COLOR_BLACK);
-    tft->setTextDatum(MC_DATUM);
-    tft->setFreeFont(&DSEG7_Classic_Regular_28);
-    tft->drawString("BATT", 120, 30);
-    tft->setFreeFont(NULL);
+    scr.add(new Label(60, 80, 0, 0, "Voltage:", 2, COLOR_CYAN, COLOR_BLACK));
+    batteryUi.voltage = scr.add(new ValueField(170, 80, 100, 18, 2, COLOR_WHITE, COLOR_BLACK, " V"));
     
-    tft->setTextFont(2);
+    scr.add(new Label(60, 110, 0, 0, "Level:", 2, COLOR_CYAN, COLOR_BLACK));
+    batteryUi.level = scr.add(new ValueField(170, 110, 100, 18, 2, COLOR_WHITE, COLOR_BLACK, " %"));
     
-    tft->setTextColor(COLOR_CYAN, COLOR_BLACK);
-    tft->drawString("Voltage:", 60, 80);
-    tft->setTextColor(COLOR_WHITE, COLOR_BLACK);
-    tft->drawString(String(voltage, 2) + " V", 170, 80);
-    
-    tft->setTextColor(COLOR_CYAN, COLOR_BLACK);
-    tft->drawString("Level:", 60, 110);
-    tft->setTextColor(percentage > 20 ? COLOR_WHITE : COLOR_RED, COLOR_BLACK);
-    tft->drawString(String((int)percentage) + " %", 170, 110);
-    
-    tft->setTextColor(COLOR_CYAN, COLOR_BLACK);
-    tft->drawString("Status:", 60, 140);
-    tft->setTextColor(isCharging ? TFT_GREEN : COLOR_WHITE, COLOR_BLACK);
-    tft->drawString(isCharging ? "Charging" : "Discharge", 170, 140);
+    scr.add(new Label(60, 140, 0, 0, "Status:", 2, COLOR_CYAN, COLOR_BLACK));
+    batteryUi.status = scr.add(new Label(170, 140, 100, 18, "", 2, COLOR_WHITE, COLOR_BLACK));
     
     int battWidth = 100;
     int battHeight = 40;
     int battX = (240 - battWidth) / 2;
     int battY = 170;
     
-    tft->drawRect(battX, battY, battWidth, battHeight, COLOR_WHITE);
-    tft->fillRect(battX + battWidth, battY + 10, 8, 20, COLOR_WHITE);
+    batteryUi.bar = scr.add(new ProgressBar(battX, battY, battWidth, battHeight, COLOR_WHITE, COLOR_BLACK));
+    scr.add(new Box(battX + battWidth, battY + 10, 8, 20, COLOR_WHITE, true));
+    
+    scr.add(new Label(120, 225, 0, 0, "Tap to go back", 1, COLOR_CYAN, COLOR_BLACK));
+}
+
+void WatchUICLASS::drawBatteryInfoScreen() {
+    if (!batteryUi.screen.isBuilt()) {
+        buildBatteryScreen();
+    }
+    if (firstDraw) {
+        batteryUi.screen.invalidateAll();
+        firstDraw = false;
+    }
+    
+    float voltage = power->getBattVoltage() / 1000.0;
+    float percentage = getBatteryPercentage();
+    bool isCharging = power->isChargeing();
+    
+    batteryUi.voltage->setValue(voltage, 2);
+    batteryUi.level->setValue((int)percentage);
+    batteryUi.level->setColor(percentage > 20 ? COLOR_WHITE : COLOR_RED);
+    batteryUi.status->setText(isCharging ? "Charging" : "Discharge");
+    batteryUi.status->setColor(isCharging ? TFT_GREEN : COLOR_WHITE);
     
-    int fillWidth = (int)((battWidth - 4) * percentage / 100);
     uint16_t fillColor = percentage > 50 ? TFT_GREEN : 
                          percentage > 20 ? COLOR_ORANGE : COLOR_RED;
-    tft->fillRect(battX + 2, battY + 2, fillWidth, battHeight - 4, fillColor);
+    batteryUi.bar->setValue((int)percentage, fillColor);
     
-    tft->setTextColor(COLOR_CYAN, COLOR_BLACK);
-    tft->setTextFont(1);
-    tft->drawString("Tap to go back", 120, 225);
-    
-    firstDraw = false;
+    batteryUi.screen.render(&canvas);
 }
 
 // ============================================
@@ -1090,6 +1721,10 @@ float WatchUICLASS::getBatteryPercentage() {
 }
 
 String WatchUICLASS::getWeekday(int day, int month, int year) {
+    return dayNames[getWeekdayIndex(day, month, year)];
+}
+
+int WatchUICLASS::getWeekdayIndex(int day, int month, int year) {
     int m = month;
     int y = year;
     
@@ -1105,5 +1740,5 @@ String WatchUICLASS::getWeekday(int day, int month, int year) {
     
     if (h < 0) h += 7;
     
-    return dayNames[h];
+    return h;
 }
@@ -11,6 +11,21 @@
 #include <esp_sleep.h>
 #include <math.h>
 #include "config.h"
+#include "UI-compositor.h"
+#include "UI-canvas.h"
+#include "UI-bezel.h"
+#include "UI-segment.h"
+#include "UI-anim.h"
+#include "UI-pacer.h"
+#include "UI-governor.h"
+#include "UI-widget.h"
+#include "UI-screencache.h"
+#include "UI-ambient.h"
+#include "UI-scroll.h"
+#include "UI-analog.h"
+#include "UI-speculate.h"
+#include "UI-background.h"
+#include "UI-glyphstore.h"
 
 // ============================================
 // Global Variables (extern)
@@ -25,6 +40,7 @@ extern float x[360], y[360];
 // ============================================
 const String clockNumbers[12] = {"45", "40", "35", "30", "25", "20", "15", "10", "05", "0", "55", "50"};
 const String dayNames[7] = {"SAT", "SUN", "MON", "TUE", "WED", "THU", "FRI"};
+const char *const dayNamesKo[7] = {"토요일", "일요일", "월요일", "화요일", "수요일", "목요일", "금요일"};   // 🆕 USE_HANGUL_TEXT
 
 // ============================================
 // Application States
@@ -36,7 +52,8 @@ enum class AppState {
     BATTERY_INFO,
     WATCH_FACE,
     NTP_SYNC,       // ✅ NTP 동기화 화면 추가
-    WIFI_SETTINGS
+    WIFI_SETTINGS,
+    AMBIENT         // 🆕 저전력 상시 표시 (시:분만)
 };
 
 // ============================================
@@ -75,6 +92,53 @@ struct TouchState {
     }
 };
 
+// ============================================
+// Clock Frame Snapshot (RTC 문자열 + 배터리, 프레임당 한 번 읽음)
+// ============================================
+struct ClockFrame {
+    String sec;
+    String minStr;
+    String hr;
+    String d1, d2;
+    String m1, m2;
+    int day;
+    int month;
+    int year;
+    int battPct;
+    uint16_t secMs;     // 🆕 현재 초 안의 경과 ms (부드러운 회전용)
+};
+
+// ============================================
+// 🆕 Retained Screens (위젯 + 값이 바뀌는 위젯 포인터)
+// ============================================
+struct SplashWidgets {
+    WidgetScreen screen;
+    ProgressBar *bar;
+    ValueField *percent;
+    Label *status;
+};
+
+struct MenuWidgets {
+    WidgetScreen screen;
+    Label *syncInfo;
+};
+
+struct NtpWidgets {
+    WidgetScreen screen;
+    Label *last;
+    Label *status;
+    Button *sync;       // 터치 판정도 위젯 영역으로
+    Label *back;
+};
+
+struct BatteryWidgets {
+    WidgetScreen screen;
+    ValueField *voltage;
+    ValueField *level;
+    Label *status;
+    ProgressBar *bar;
+};
+
 // ============================================
 // WatchUICLASS
 // ============================================
@@ -97,6 +161,7 @@ private:
     
     // State variables
     unsigned long lastActivityTime;
+    unsigned long lastInputTime;     // 🆕 마지막 터치/버튼/화면 전환 (상시 표시 진입 기준)
     unsigned long lastUpdateTime;
     unsigned long lastNtpSyncTime;   // ✅ 마지막 NTP 동기화 시간
     int sleepTimeout;
@@ -104,6 +169,8 @@ private:
     bool displayInitialized;
     
     // Animation variables
+    AnimationClock animClock;      // 🆕 프레임 시각 (µs)
+    AngleAnimation orbit;          // 🆕 궤도 점 회전 (고정 각속도)
     int rAngle;
     int lastAngle;
     int angle;
@@ -138,9 +205,20 @@ private:
     // Drawing methods
     void drawSplashScreen(const char* status, int progress);  // 🆕 스플래시 화면
     void drawClockFace();
+    void readClockFrame(ClockFrame &t);
+    void renderClockFace(UICanvas *tft, const ClockFrame &t, bool repaint);
+    void drawClockStatics(UICanvas *tft);   // 🆕 시계의 고정 라벨/테두리/NTP 아이콘
     void drawMenuScreen();
     void drawBatteryInfoScreen();
     void drawNtpSyncScreen();    // ✅ NTP 동기화 화면
+    void drawAmbientFace();      // 🆕 상시 표시 (시:분)
+    void buildSplashScreen();    // 🆕 위젯 트리 생성 (화면당 한 번)
+    void buildMenuScreen();
+    void buildNtpScreen();
+    void buildBatteryScreen();
+    void flushFrame();           // 🆕 손상 영역 push + 프레임 통계
+    void logFrameStats();
+    void syncPanel();            // 🆕 DMA 전송 완료 대기
     
     // ✅ NTP/WiFi methods
     bool connectWiFi();
@@ -152,10 +230,72 @@ private:
     // Utility
     float getBatteryPercentage();
     String getWeekday(int day, int month, int year);
+    int getWeekdayIndex(int day, int month, int year);   // 🆕 0 = 토요일 (dayNames 순서)
 
     int lastMinute = -1;              // 🆕 추가
     uint16_t circleColor = COLOR_RED; // 🆕 추가
     uint16_t getRandomColor();     // 🆕 랜덤 색상 생성
+
+#ifdef USE_SPRITE_COMPOSITOR
+    SpriteCompositor compositor;   // 🆕 오프스크린 합성
+    ScreenCache screens;           // 🆕 화면 전환용 스냅샷
+    int8_t cacheSlotFor(AppState state) const;
+    uint32_t cacheTagFor(AppState state);
+    void saveScreen(AppState state);
+    bool restoreScreen(AppState state);
+    
+    AnalogFace analog;             // 🆕 바늘 시계 (회전 스프라이트 + 경계 사각형 복원)
+    bool analogFace = false;
+    void drawAnalogFace();
+    
+#ifdef USE_SPECULATIVE_RENDER
+    FrameSpeculator spec;          // 🆕 다음 초 미리 그리기 (초 경계에서 복사만)
+    ClockFrame lastClock;          // 마지막으로 그린 시계 프레임 (예측 기준)
+    ClockFrame specClock;          // 미리 그린 다음 초
+    void speculateNextSecond();
+    void commitSpeculation(const ClockFrame &t);
+#endif
+#endif
+    void toggleWatchFace();        // 🆕 디지털 ↔ 아날로그
+    
+    int rtcSecond = -1;            // 🆕 RTC 초가 바뀐 시각 (초 단위 RTC → ms 보간)
+    unsigned long rtcSecondStart = 0;
+    uint16_t msIntoSecond(int second);
+    UICanvas canvas;               // 🆕 모든 화면의 그리기 대상
+    DirtyRegion damage;            // 🆕 프레임별 손상 영역
+    GlyphCache glyphs;             // 🆕 RGB565 글리프 타일 캐시
+#ifdef USE_HANGUL_TEXT
+    GlyphStore hangul;             // 🆕 LittleFS 한글 글리프 (RAM LRU 슬롯)
+#endif
+    TextMetricsCache metrics;      // 🆕 문자열 폭/높이 (datum 정렬용)
+    BezelRing bezel;               // 🆕 미리 래스터화한 회전 베젤
+    SegmentReadout secDigits;      // 🆕 초 (세그먼트 diff)
+    SegmentReadout timeDigits;     // 🆕 시:분 (세그먼트 diff)
+#ifdef USE_CLOCK_BACKGROUND
+    BackgroundImage clockBg;       // 🆕 고정 요소 RLE 이미지 (firstDraw = 행 push)
+    bool clockBgFailed = false;    // 생성 실패 → 이후엔 기존처럼 글리프로 그림
+    bool drawClockBackground(UICanvas *tft);
+#endif
+    unsigned long lastStatsLog = 0;
+    
+    SplashWidgets splashUi;        // 🆕 유지형 위젯 화면
+    MenuWidgets menuUi;
+    ScrollList menuList;           // 🆕 메뉴 항목 (하드웨어 세로 스크롤)
+    NtpWidgets ntpUi;
+    BatteryWidgets batteryUi;
+    
+    FramePacer pacer;              // 🆕 상태별 프레임 데드라인
+    unsigned long lastPacerLog = 0;
+    uint32_t framePeriodFor(AppState state) const;
+    FrameGovernor governor;        // 🆕 상태/밝기별 프레임 속도
+    bool isStaticScreen(AppState state) const;
+    
+    AmbientDisplay ambientPanel;   // 🆕 ST7789 idle/partial 모드
+    String ambientTime;            // 🆕 상시 표시 중 마지막으로 그린 시:분
+    uint32_t savedCpuMhz = 0;
+    void enterAmbient();
+    void exitAmbient();
+    uint32_t ambientPeriodMs();
     
 public:
     WatchUICLASS();
@@ -166,11 +306,20 @@ public:
     void setupDisplay();
     void checkStatus();
     void updateUI();
+    void waitNextFrame();        // 🆕 loop()의 delay(20) 대체
     
     // Brightness control
     void setBrightness(int level);
     int getBrightness() const { return brightness; }
     
+    // 🆕 프레임 모니터링 (마지막 프레임의 손상 면적/사각형 수)
+    int32_t getLastDamagedArea() const { return damage.getLastArea(); }
+    uint8_t getLastDamagedRects() const { return damage.getLastCount(); }
+    
+    // 🆕 Display List (마지막 프레임의 기록 op / 실제 실행 op)
+    uint16_t getLastOpsRecorded() const { return canvas.getLastRecorded(); }
+    uint16_t getLastOpsEmitted() const { return canvas.getLastEmitted(); }
+    
     // ✅ NTP Sync - 외부에서 호출 가능
     bool performNtpSync();
     bool isNtpSynced() const { return ntpSyncedToday; }
@@ -0,0 +1,144 @@
+// ============================================
+// TTGO Watch Frame Pacer Implementation
+// Version: 2.5 - Deadline Scheduling
+// ============================================
+
+#include "UI-pacer.h"
+#include <esp_timer.h>
+#ifdef PACER_LIGHT_SLEEP
+#include <esp_sleep.h>
+#include <driver/gpio.h>
+#endif
+
+TaskHandle_t FramePacer::waiter = nullptr;
+
+FramePacer::FramePacer() {
+    periodMs = FRAME_MS_CLOCK;
+    periodTicks = pdMS_TO_TICKS(FRAME_MS_CLOCK);
+    lastWake = 0;
+    frameStartUs = 0;
+    started = false;
+
+    frames = 0;
+    missed = 0;
+    wakeups = 0;
+    maxWorkUs = 0;
+    busyUs = 0;
+    statsStartUs = 0;
+    memset(hist, 0, sizeof(hist));
+}
+
+void FramePacer::begin(uint32_t ms) {
+    setPeriod(ms);
+    lastWake = xTaskGetTickCount();
+    frameStartUs = esp_timer_get_time();
+    started = true;
+    waiter = xTaskGetCurrentTaskHandle();
+    resetStats();
+
+#ifdef PACER_LIGHT_SLEEP
+    // 버튼(AXP IRQ)과 터치 인터럽트는 LOW 활성
+    gpio_wakeup_enable((gpio_num_t)BUTTON_PIN, GPIO_INTR_LOW_LEVEL);
+    gpio_wakeup_enable((gpio_num_t)TOUCH_INT_PIN, GPIO_INTR_LOW_LEVEL);
+    esp_sleep_enable_gpio_wakeup();
+    _PF("Pacer: %u ms period, light sleep >= %d ms\n", periodMs, PACER_LIGHT_SLEEP_MIN_MS);
+#else
+    _PF("Pacer: %u ms period\n", periodMs);
+#endif
+}
+
+void FramePacer::setPeriod(uint32_t ms) {
+    if (ms == 0) ms = 1;
+    periodMs = ms;
+    periodTicks = max((TickType_t)1, pdMS_TO_TICKS(ms));
+}
+
+// ============================================
+// Deadline Wait
+// ============================================
+void FramePacer::wait() {
+    if (!started) begin(periodMs);
+
+    int64_t workUs = esp_timer_get_time() - frameStartUs;
+    busyUs += workUs;
+    maxWorkUs = max(maxWorkUs, (uint32_t)workUs);
+    frames++;
+    uint32_t bucket = min((int64_t)(PACER_HIST_BUCKETS - 1), workUs / PACER_HIST_US);
+    if (hist[bucket] < UINT16_MAX) hist[bucket]++;
+
+    TickType_t elapsed = xTaskGetTickCount() - lastWake;
+    if (elapsed >= periodTicks) {
+        // 늦은 프레임: 지나간 데드라인은 버리고 지금을 새 기준으로 (몰아서 그리지 않음)
+        missed += elapsed / periodTicks;
+        vTaskDelay(1);      // 최소 1틱은 다른 태스크에 양보
+        lastWake = xTaskGetTickCount();
+    } else {
+        idle(periodTicks - elapsed);
+    }
+
+    frameStartUs = esp_timer_get_time();
+}
+
+void FramePacer::idle(TickType_t ticks) {
+#ifdef PACER_LIGHT_SLEEP
+    uint32_t idleMs = ticks * portTICK_PERIOD_MS;
+    if (idleMs >= PACER_LIGHT_SLEEP_MIN_MS) {
+        esp_sleep_enable_timer_wakeup((uint64_t)idleMs * 1000ULL);
+        esp_light_sleep_start();
+        // 터치로 일찍 깨어날 수 있으므로 깨어난 시점을 기준으로
+        lastWake = xTaskGetTickCount();
+        return;
+    }
+#endif
+    // vTaskDelayUntil과 같은 데드라인이지만 인터럽트 알림으로 일찍 깰 수 있음
+    if (ulTaskNotifyTake(pdTRUE, ticks) > 0) {
+        wakeups++;
+        lastWake = xTaskGetTickCount();
+    } else {
+        lastWake += periodTicks;
+    }
+}
+
+void IRAM_ATTR FramePacer::wakeFromISR() {
+    if (waiter == nullptr) return;
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(waiter, &woken);
+    portYIELD_FROM_ISR(woken);
+}
+
+// ============================================
+// Statistics
+// ============================================
+uint8_t FramePacer::getBusyPercent() const {
+    int64_t total = esp_timer_get_time() - statsStartUs;
+    if (total <= 0) return 0;
+    return (uint8_t)min((int64_t)100, busyUs * 100 / total);
+}
+
+// 히스토그램 누적 분포에서 pct%에 처음 도달하는 칸의 상한
+uint32_t FramePacer::getPercentileUs(uint8_t pct) const {
+    uint32_t total = 0;
+    for (uint8_t i = 0; i < PACER_HIST_BUCKETS; i++) total += hist[i];
+    if (total == 0) return 0;
+
+    uint32_t target = (total * pct + 99) / 100;
+    uint32_t seen = 0;
+    for (uint8_t i = 0; i < PACER_HIST_BUCKETS; i++) {
+        seen += hist[i];
+        if (seen >= target) {
+            // 마지막 칸은 상한이 없음 → 최대값으로 보고
+            return i == PACER_HIST_BUCKETS - 1 ? maxWorkUs : (i + 1) * PACER_HIST_US;
+        }
+    }
+    return maxWorkUs;
+}
+
+void FramePacer::resetStats() {
+    memset(hist, 0, sizeof(hist));
+    frames = 0;
+    missed = 0;
+    wakeups = 0;
+    maxWorkUs = 0;
+    busyUs = 0;
+    statsStartUs = esp_timer_get_time();
+}
@@ -0,0 +1,69 @@
+// ============================================
+// TTGO Watch Frame Pacer
+// Version: 2.5 - Deadline Scheduling
+// ============================================
+#ifndef UI_PACER_H
+#define UI_PACER_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include "config.h"
+
+#define PACER_HIST_BUCKETS  64      // 프레임 작업 시간 히스토그램 칸 수 (마지막 칸 = 그 이상)
+#define PACER_HIST_US       500     // 칸 폭 (µs) → 32ms까지 구분
+
+// ============================================
+// FramePacer
+//   - 고정 delay 대신 프레임 시작 기준 데드라인까지 대기 (vTaskDelayUntil 방식)
+//   - 데드라인을 넘기면 놓친 프레임 수만 세고 따라잡지 않음
+//   - PACER_LIGHT_SLEEP: 긴 유휴 시간은 light sleep (타이머/버튼/터치로 깨어남)
+//   - 🆕 wakeFromISR(): 터치/버튼 인터럽트가 대기를 즉시 끝냄
+// ============================================
+class FramePacer {
+public:
+    FramePacer();
+
+    void begin(uint32_t periodMs);
+
+    // 다음 데드라인부터 적용
+    void setPeriod(uint32_t periodMs);
+    uint32_t getPeriod() const { return periodMs; }
+
+    // 이번 프레임 작업이 끝난 뒤 호출
+    void wait();
+
+    // 인터럽트에서 호출 - 대기 중이면 바로 다음 프레임 시작
+    static void wakeFromISR();
+
+    // 통계 (resetStats 이후)
+    uint32_t getFrames() const { return frames; }
+    uint32_t getMissed() const { return missed; }
+    uint32_t getWakeups() const { return wakeups; }
+    uint32_t getMaxWorkUs() const { return maxWorkUs; }
+    uint8_t getBusyPercent() const;
+    // 🆕 작업 시간 백분위 (칸의 상한값, 예: 50 / 90 / 99)
+    uint32_t getPercentileUs(uint8_t pct) const;
+    void resetStats();
+
+private:
+    uint32_t periodMs;
+    TickType_t periodTicks;
+    TickType_t lastWake;
+    int64_t frameStartUs;
+    bool started;
+
+    uint32_t frames;
+    uint32_t missed;
+    uint32_t wakeups;
+    uint32_t maxWorkUs;
+    int64_t busyUs;
+    int64_t statsStartUs;
+    uint16_t hist[PACER_HIST_BUCKETS];
+
+    static TaskHandle_t waiter;
+
+    void idle(TickType_t ticks);
+};
+
+#endif // UI_PACER_H
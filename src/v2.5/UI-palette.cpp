@@ -0,0 +1,147 @@
+// ============================================
+// TTGO Watch 4-bpp Palette Implementation
+// Version: 2.5 - Palettized Framebuffer
+// ============================================
+
+#include "UI-palette.h"
+
+// 화면 코드가 쓰는 고정 색상 (config.h)
+static const uint16_t fixedColors[] = {
+    COLOR_BLACK, COLOR_WHITE, COLOR_RED, COLOR_GREEN, COLOR_BLUE, COLOR_ORANGE,
+    COLOR_YELLOW, COLOR_CYAN, COLOR_GRAY1, COLOR_GRAY2, COLOR_GRAY3
+};
+
+Palette16::Palette16() {
+    backPixels = nullptr;
+    frontPixels = nullptr;
+    pixelBytes = 0;
+    version = 0;
+    reclaims = 0;
+    reset();
+}
+
+void Palette16::reset() {
+    count = 0;
+    for (uint8_t i = 0; i < sizeof(fixedColors) / sizeof(fixedColors[0]); i++) {
+        setEntry(count++, fixedColors[i]);
+    }
+    fixedCount = count;
+    for (uint8_t i = count; i < PALETTE_SIZE; i++) {
+        setEntry(i, COLOR_BLACK);
+    }
+    lastColor = COLOR_BLACK;
+    lastIndex = 0;
+    version++;
+}
+
+void Palette16::setPixels(const uint8_t *back, const uint8_t *front, size_t bytes) {
+    backPixels = back;
+    frontPixels = front;
+    pixelBytes = bytes;
+}
+
+void Palette16::setEntry(uint8_t index, uint16_t color) {
+    colors[index] = color;
+    lut[index] = (color >> 8) | (color << 8);
+}
+
+// ============================================
+// Color → Index
+// ============================================
+uint8_t Palette16::indexOf(uint16_t color) {
+    if (color == lastColor) return lastIndex;
+
+    for (uint8_t i = 0; i < count; i++) {
+        if (colors[i] == color) {
+            lastColor = color;
+            lastIndex = i;
+            return i;
+        }
+    }
+
+    int8_t slot = count < PALETTE_SIZE ? count++ : reclaim();
+    if (slot >= 0) {
+        // 새 슬롯: 아직 어떤 픽셀도 이 인덱스를 쓰지 않으므로 version 유지
+        setEntry(slot, color);
+    } else {
+        slot = nearest(color);
+    }
+    lastColor = color;
+    lastIndex = slot;
+    return slot;
+}
+
+// 백버퍼와 패널 사본 모두에서 안 쓰는 동적 슬롯을 찾음
+//   패널 사본에 남은 인덱스를 재사용하면 diff가 변경을 놓치므로 둘 다 확인
+int8_t Palette16::reclaim() {
+    if (backPixels == nullptr) return -1;
+
+    uint16_t used = 0;
+    const uint8_t *bufs[2] = { backPixels, frontPixels };
+    for (int b = 0; b < 2; b++) {
+        if (bufs[b] == nullptr) continue;
+        for (size_t i = 0; i < pixelBytes; i++) {
+            used |= (1 << (bufs[b][i] >> 4)) | (1 << (bufs[b][i] & 0x0F));
+        }
+    }
+
+    for (uint8_t i = fixedCount; i < PALETTE_SIZE; i++) {
+        if (!(used & (1 << i))) {
+            reclaims++;
+            return i;
+        }
+    }
+    return -1;
+}
+
+uint8_t Palette16::nearest(uint16_t color) const {
+    int16_t r = color >> 11, g = (color >> 5) & 0x3F, b = color & 0x1F;
+    uint8_t best = 0;
+    int32_t bestDist = INT32_MAX;
+    for (uint8_t i = 0; i < count; i++) {
+        int16_t dr = r - (colors[i] >> 11);
+        int16_t dg = g - ((colors[i] >> 5) & 0x3F);
+        int16_t db = b - (colors[i] & 0x1F);
+        int32_t d = 4 * dr * dr + dg * dg + 4 * db * db;
+        if (d < bestDist) {
+            bestDist = d;
+            best = i;
+        }
+    }
+    return best;
+}
+
+// ============================================
+// Theme Swap
+// ============================================
+bool Palette16::remap(uint16_t from, uint16_t to) {
+    for (uint8_t i = 0; i < count; i++) {
+        if (colors[i] == from) {
+            setEntry(i, to);
+            lastColor = to;
+            lastIndex = i;
+            version++;
+            return true;
+        }
+    }
+    return false;
+}
+
+// ============================================
+// Expansion (push 중 호출)
+// ============================================
+void Palette16::expand(const uint8_t *row, int16_t x, int16_t w, uint16_t *out) const {
+    const uint8_t *p = row + (x >> 1);
+    if (x & 1) {
+        *out++ = lut[*p++ & 0x0F];
+        w--;
+    }
+    for (; w >= 2; w -= 2) {
+        uint8_t b = *p++;
+        *out++ = lut[b >> 4];
+        *out++ = lut[b & 0x0F];
+    }
+    if (w > 0) {
+        *out = lut[*p >> 4];
+    }
+}
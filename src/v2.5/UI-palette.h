@@ -0,0 +1,65 @@
+// ============================================
+// TTGO Watch 4-bpp Palette
+// Version: 2.5 - Palettized Framebuffer
+// ============================================
+#ifndef UI_PALETTE_H
+#define UI_PALETTE_H
+
+#include <Arduino.h>
+#include "config.h"
+
+#define PALETTE_SIZE    16
+
+// ============================================
+// Palette16
+//   - 4비트 프레임버퍼의 색 인덱스 ↔ RGB565
+//   - config.h 색상은 고정 슬롯, 나머지(랜덤 circleColor 등)는 처음 쓸 때 할당
+//   - 가득 차면 프레임버퍼에서 안 쓰는 동적 슬롯을 재사용, 그래도 없으면 가장 가까운 색
+//   - 색을 바꾸면(테마/야간 모드) version 증가 → 합성기가 다시 그리지 않고 재전송만
+// ============================================
+class Palette16 {
+public:
+    Palette16();
+
+    // 고정 색상 로드 (인덱스 0 = 검정 → 0으로 채운 버퍼는 검정)
+    void reset();
+
+    // 회수 시 스캔할 4bpp 버퍼 (백버퍼 + 패널 사본)
+    void setPixels(const uint8_t *back, const uint8_t *front, size_t bytes);
+
+    // RGB565 → 인덱스 (없으면 할당)
+    uint8_t indexOf(uint16_t color);
+    uint16_t colorAt(uint8_t index) const { return colors[index & 0x0F]; }
+
+    // 🆕 테마 교체: from 색을 쓰는 모든 픽셀이 to로 보임 (다시 그리기 없음)
+    bool remap(uint16_t from, uint16_t to);
+
+    // 인덱스 w개 → 스프라이트 버퍼 순서 RGB565 (x는 행 안의 픽셀 위치)
+    void expand(const uint8_t *row, int16_t x, int16_t w, uint16_t *out) const;
+
+    uint32_t getVersion() const { return version; }
+    uint8_t getUsed() const { return count; }
+    uint32_t getReclaims() const { return reclaims; }
+
+private:
+    uint16_t colors[PALETTE_SIZE];
+    uint16_t lut[PALETTE_SIZE];     // 바이트 스왑된 colors
+    uint8_t count;
+    uint8_t fixedCount;
+    uint32_t version;
+    uint32_t reclaims;
+
+    // 최근 변환 (같은 색 연속 그리기가 대부분)
+    uint16_t lastColor;
+    uint8_t lastIndex;
+
+    const uint8_t *backPixels;
+    const uint8_t *frontPixels;
+    size_t pixelBytes;
+
+    void setEntry(uint8_t index, uint16_t color);
+    int8_t reclaim();
+    uint8_t nearest(uint16_t color) const;
+};
+
+#endif // UI_PALETTE_H
@@ -0,0 +1,50 @@
+// ============================================
+// TTGO Watch Screen Snapshot Cache
+// Version: 2.5 - Instant Transitions
+// ============================================
+#ifndef UI_SCREENCACHE_H
+#define UI_SCREENCACHE_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// ============================================
+// ScreenCache
+//   - 화면을 떠날 때 백버퍼(240x240 RGB565)를 PSRAM 슬롯에 저장
+//   - 다시 들어올 때 memcpy 한 번으로 복원 → 전체 push 한 번 + 바뀐 부분만 갱신
+//   - tag: 스냅샷이 유효한 조건 (예: 시계 화면의 날짜), 다르면 미스
+//   - PSRAM 없으면 비활성 (기존처럼 지우고 다시 그림)
+// ============================================
+class ScreenCache {
+public:
+    ScreenCache();
+    ~ScreenCache();
+
+    bool begin();
+    void end();
+    bool isEnabled() const { return enabled; }
+
+    // frame: 스프라이트 버퍼 (SCREEN_WIDTH x SCREEN_HEIGHT)
+    bool capture(uint8_t slot, const uint16_t *frame, uint32_t tag = 0);
+    bool restore(uint8_t slot, uint16_t *frame, uint32_t tag = 0);
+    void drop(uint8_t slot);
+    void clear();
+
+    // 통계
+    uint32_t getHits() const { return hits; }
+    uint32_t getMisses() const { return misses; }
+    uint32_t getCaptures() const { return captures; }
+    uint8_t getUsedSlots() const;
+
+private:
+    uint16_t *pixels[SCREEN_CACHE_SLOTS];   // 첫 capture 때 할당
+    uint32_t tags[SCREEN_CACHE_SLOTS];
+    bool valid[SCREEN_CACHE_SLOTS];
+    bool enabled;
+
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t captures;
+};
+
+#endif // UI_SCREENCACHE_H
@@ -0,0 +1,231 @@
+// ============================================
+// TTGO Watch Hardware Scroll List Implementation
+// Version: 2.5 - Vertical Scroll List
+// ============================================
+
+#include "UI-scroll.h"
+
+// ST7789 명령
+#define ST_CMD_VSCRDEF  0x33    // 세로 스크롤 영역 (상단 고정 / 스크롤 / 하단 고정)
+#define ST_CMD_VSCSAD   0x37    // 세로 스크롤 시작 주소
+#define ST_GRAM_ROWS    320     // 240x240 패널도 GRAM은 320행
+
+ScrollList::ScrollList() {
+    tft = nullptr;
+    band = nullptr;
+    metrics = nullptr;
+    hardware = false;
+    flipped = false;
+    defined = false;
+    top = 0;
+    height = 0;
+    itemHeight = 1;
+    memTop = 0;
+    bgColor = TFT_BLACK;
+    count = 0;
+    offset = 0;
+    shown = 0;
+    dragged = false;
+    dragStartY = 0;
+    dragLastY = 0;
+    lastRows = 0;
+    scrolls = 0;
+}
+
+ScrollList::~ScrollList() {
+    if (band != nullptr) {
+        band->deleteSprite();
+        delete band;
+    }
+}
+
+bool ScrollList::begin(TFT_eSPI *panel, uint8_t rotation, int16_t winTop, int16_t winHeight,
+                       int16_t rowHeight, uint16_t bg) {
+    tft = panel;
+    top = winTop;
+    height = winHeight;
+    itemHeight = max(rowHeight, (int16_t)1);
+    bgColor = bg;
+
+    // 회전 0: GRAM 행 = y, 회전 2(MX|MY): GRAM 행 = 239 - y → 창이 GRAM에서 뒤집힘
+    hardware = rotation == 0 || rotation == 2;
+    flipped = rotation == 2;
+    memTop = flipped ? SCREEN_HEIGHT - (top + height) : top;
+
+    if (band == nullptr) {
+        band = new TFT_eSprite(panel);
+        band->setColorDepth(16);
+        if (band->createSprite(SCREEN_WIDTH, SCROLL_BAND_HEIGHT) == nullptr) {
+            delete band;
+            band = nullptr;
+            _PL("ScrollList: band allocation failed");
+            return false;
+        }
+    }
+
+    _PF("ScrollList: rows %d..%d, %s scroll\n", top, top + height - 1, hardware ? "hardware" : "redraw");
+    return true;
+}
+
+void ScrollList::setItems(uint16_t n, const ItemFn &fn) {
+    count = n;
+    drawItem = fn;
+    offset = constrain(offset, (int16_t)0, maxOffset());
+}
+
+// ============================================
+// Full Draw (고정 영역과 같은 경로 → 컴포지터 프레임/스냅샷에도 남음)
+// ============================================
+void ScrollList::drawAll(UICanvas *t) {
+    end();
+    if (!drawItem) return;
+
+    for (uint16_t i = 0; i < count && (i + 1) * itemHeight <= height; i++) {
+        drawItem(t, i, top + i * itemHeight + itemHeight / 2);
+    }
+}
+
+// ============================================
+// Touch / Scroll
+// ============================================
+void ScrollList::onTouch(bool pressed, bool wasPressed, int16_t y) {
+    if (pressed && !wasPressed) {
+        dragStartY = dragLastY = y;
+        dragged = false;
+        return;
+    }
+    if (!pressed) return;
+
+    if (!dragged && dragStartY >= top && dragStartY < top + height &&
+        abs(y - dragStartY) >= SCROLL_DRAG_THRESHOLD) {
+        dragged = true;
+    }
+    if (dragged) {
+        scrollBy(dragLastY - y);
+    }
+    dragLastY = y;
+}
+
+void ScrollList::scrollBy(int16_t dy) {
+    offset = constrain((int16_t)(offset + dy), (int16_t)0, maxOffset());
+}
+
+int16_t ScrollList::itemAt(int16_t y) const {
+    if (y < top || y >= top + height) return -1;
+
+    int16_t index = (y - top + shown) / itemHeight;
+    return index < count ? index : -1;
+}
+
+int16_t ScrollList::maxOffset() const {
+    return max((int16_t)0, (int16_t)(count * itemHeight - height));
+}
+
+// ============================================
+// Render - 새로 드러난 행만
+// ============================================
+void ScrollList::render() {
+    lastRows = 0;
+    if (tft == nullptr || band == nullptr || offset == shown) return;
+
+    int16_t from = shown;
+    shown = offset;
+    scrolls++;
+
+    // 시작 주소를 먼저 옮김 → 그리는 동안 보이는 것은 밀려나는 이전 행
+    if (hardware) {
+        setStart(offset);
+    }
+
+    bool oldSwap = tft->getSwapBytes();
+    tft->setSwapBytes(false);   // 스프라이트 버퍼는 이미 패널 바이트 순서
+
+    if (!hardware || abs(offset - from) >= height) {
+        exposeRows(offset, offset + height);
+    } else if (offset > from) {
+        exposeRows(from + height, offset + height);     // 아래쪽이 드러남
+    } else {
+        exposeRows(offset, from);                       // 위쪽이 드러남
+    }
+
+    tft->setSwapBytes(oldSwap);
+}
+
+// 내용 행 c는 링 슬롯 c mod height에 저장 (하드웨어 스크롤이 없으면 창에 그대로)
+int16_t ScrollList::slotOf(int16_t row) const {
+    return hardware ? row % height : row - offset;
+}
+
+// [first, last) 내용 행을 띠 단위로, 링 끝에서 나눠 그림
+void ScrollList::exposeRows(int16_t first, int16_t last) {
+    int16_t row = first;
+    while (row < last) {
+        int16_t slot = slotOf(row);
+        int16_t rows = min((int16_t)(last - row), (int16_t)SCROLL_BAND_HEIGHT);
+        rows = min(rows, (int16_t)(height - slot));
+
+        paintRows(row, rows, top + slot);
+        row += rows;
+        lastRows += rows;
+    }
+}
+
+void ScrollList::paintRows(int16_t first, int16_t rows, int16_t y) {
+    band->fillSprite(bgColor);
+
+    if (drawItem) {
+        UICanvas out(band);
+        out.setMetricsCache(metrics);
+        int16_t i0 = first / itemHeight;
+        int16_t i1 = (first + rows - 1) / itemHeight;
+        for (int16_t i = i0; i <= i1 && i < count; i++) {
+            drawItem(&out, i, i * itemHeight + itemHeight / 2 - first);
+        }
+    }
+
+    tft->pushImage(0, y, SCREEN_WIDTH, rows, (uint16_t *)band->getPointer());
+}
+
+// ============================================
+// Scroll Registers
+// ============================================
+// 창의 첫 표시 행이 보여 줄 GRAM 행
+//   회전 0: 내용 offset+k → 표시 행 memTop+k
+//   회전 2: 표시 순서가 논리 y와 반대 → 시작 주소도 반대 방향으로 이동
+void ScrollList::setStart(int16_t scroll) {
+    if (!defined) {
+        defineArea(memTop, height, ST_GRAM_ROWS - memTop - height);
+        defined = true;
+    }
+
+    int16_t s = scroll % height;
+    uint16_t vsp = memTop + (flipped ? (height - s) % height : s);
+
+    tft->writecommand(ST_CMD_VSCSAD);
+    tft->writedata(vsp >> 8);
+    tft->writedata(vsp & 0xFF);
+}
+
+void ScrollList::defineArea(uint16_t tfa, uint16_t vsa, uint16_t bfa) {
+    tft->writecommand(ST_CMD_VSCRDEF);
+    tft->writedata(tfa >> 8);
+    tft->writedata(tfa & 0xFF);
+    tft->writedata(vsa >> 8);
+    tft->writedata(vsa & 0xFF);
+    tft->writedata(bfa >> 8);
+    tft->writedata(bfa & 0xFF);
+}
+
+// 전체 화면을 다시 그리기 전에 호출: 스크롤 영역을 해제하고 맨 위로
+void ScrollList::end() {
+    if (defined && tft != nullptr) {
+        defineArea(0, ST_GRAM_ROWS, 0);
+        tft->writecommand(ST_CMD_VSCSAD);
+        tft->writedata(0);
+        tft->writedata(0);
+        defined = false;
+    }
+    offset = 0;
+    shown = 0;
+    dragged = false;
+}
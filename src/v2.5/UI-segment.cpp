@@ -0,0 +1,308 @@
+// ============================================
+// TTGO Watch Seven-Segment Readout Implementation
+// Version: 2.5 - Segment Diff Rendering
+// ============================================
+
+#include "UI-segment.h"
+
+#define BENCH_LOOPS     200
+
+SegmentReadout::SegmentReadout() {
+    font = nullptr;
+    smooth = nullptr;
+    centerX = 0;
+    baseline = 0;
+    top = 0;
+    bottom = 0;
+    lastRects = 0;
+    lastPixels = 0;
+    openCount = 0;
+    out = nullptr;
+    fgColor = TFT_WHITE;
+    bgColor = TFT_BLACK;
+}
+
+// TFT_eSPI와 같은 기준선: 폰트 전체의 최대 상단 높이(glyph_ab)로 MC_DATUM 정렬
+void SegmentReadout::begin(const GFXfont *gfxFont, int16_t cx, int16_t cy) {
+    font = gfxFont;
+    centerX = cx;
+
+    int16_t ascent = 0;
+    int16_t descent = 0;
+    for (uint16_t c = font->first; c <= font->last; c++) {
+        const GFXglyph *g = &font->glyph[c - font->first];
+        ascent = max(ascent, (int16_t)(-g->yOffset));
+        descent = max(descent, (int16_t)(g->height + g->yOffset));
+    }
+    baseline = cy - ascent / 2 + ascent;
+    top = baseline - ascent;
+    bottom = baseline + descent;
+}
+
+// ============================================
+// Draw
+// ============================================
+void SegmentReadout::draw(UICanvas *tft, const String &prev, const String &next, uint16_t fg, uint16_t bg) {
+    lastRects = 0;
+    lastPixels = 0;
+    if (font == nullptr) return;
+
+    out = tft;
+    fgColor = fg;
+    bgColor = bg;
+
+    if (smooth != nullptr) {
+        drawCells(prev, next);
+        return;
+    }
+
+    int16_t prevX = startX(prev);
+    int16_t nextX = startX(next);
+
+    // 같은 자리 배치면 글자별 diff, 아니면 이전 문자열 전체 지우고 새로 그림
+    if (prev.length() == next.length() && prevX == nextX) {
+        int16_t penX = nextX;
+        for (unsigned int i = 0; i < next.length(); i++) {
+            const GFXglyph *g = glyphFor(next[i]);
+            if (prev[i] != next[i]) {
+                diffGlyph(penX, prev[i], next[i]);
+            }
+            if (g != nullptr) penX += g->xAdvance;
+        }
+        return;
+    }
+
+    int16_t penX = prevX;
+    for (unsigned int i = 0; i < prev.length(); i++) {
+        const GFXglyph *g = glyphFor(prev[i]);
+        diffGlyph(penX, prev[i], ' ');
+        if (g != nullptr) penX += g->xAdvance;
+    }
+
+    penX = nextX;
+    for (unsigned int i = 0; i < next.length(); i++) {
+        const GFXglyph *g = glyphFor(next[i]);
+        diffGlyph(penX, ' ', next[i]);
+        if (g != nullptr) penX += g->xAdvance;
+    }
+}
+
+// 🆕 AA 칸 출력: 같은 배치면 바뀐 자리만, 아니면 이전 문자열 영역을 지우고 전부
+//    AA 글리프가 없는 글자는 세그먼트 diff로 그림
+void SegmentReadout::drawCells(const String &prev, const String &next) {
+    int16_t prevX = startX(prev);
+    int16_t nextX = startX(next);
+    bool sameLayout = prev.length() == next.length() && prevX == nextX;
+
+    if (!sameLayout && prev.length() > 0) {
+        out->fillRect(prevX, top, textWidth(prev), bottom - top, bgColor);
+        lastRects++;
+        lastPixels += (uint32_t)textWidth(prev) * (bottom - top);
+    }
+
+    int16_t penX = nextX;
+    for (unsigned int i = 0; i < next.length(); i++) {
+        const GFXglyph *g = glyphFor(next[i]);
+        if (!sameLayout || prev[i] != next[i]) {
+            uint8_t w = AAText::advance(smooth, next[i]);
+            if (w > 0) {
+                out->drawAAGlyph(smooth, next[i], penX, top, fgColor, bgColor);
+                lastRects++;
+                lastPixels += (uint32_t)w * smooth->height;
+            } else {
+                diffGlyph(penX, sameLayout ? prev[i] : ' ', next[i]);
+            }
+        }
+        if (g != nullptr) penX += g->xAdvance;
+    }
+}
+
+int16_t SegmentReadout::startX(const String &text) const {
+    return centerX - textWidth(text) / 2;
+}
+
+int16_t SegmentReadout::textWidth(const String &text) const {
+    int16_t width = 0;
+    for (unsigned int i = 0; i < text.length(); i++) {
+        const GFXglyph *g = glyphFor(text[i]);
+        if (g != nullptr) width += g->xAdvance;
+    }
+    return width;
+}
+
+// ============================================
+// Glyph Bitmap Access
+// ============================================
+const GFXglyph *SegmentReadout::glyphFor(char c) const {
+    uint8_t uc = (uint8_t)c;
+    if (uc < font->first || uc > font->last) return nullptr;
+    return &font->glyph[uc - font->first];
+}
+
+// GFX 비트맵은 행 경계 없이 비트 단위로 연속 저장
+bool SegmentReadout::pixel(const GFXglyph *g, int16_t gx, int16_t gy) const {
+    if (g == nullptr) return false;
+    if (gx < 0 || gy < 0 || gx >= g->width || gy >= g->height) return false;
+
+    uint32_t bit = (uint32_t)gy * g->width + gx;
+    uint8_t bits = pgm_read_byte(&font->bitmap[g->bitmapOffset + (bit >> 3)]);
+    return bits & (0x80 >> (bit & 7));
+}
+
+// ============================================
+// Segment Diff
+// ============================================
+void SegmentReadout::diffGlyph(int16_t penX, char from, char to) {
+    const GFXglyph *a = glyphFor(from);
+    const GFXglyph *b = glyphFor(to);
+    if (a == nullptr && b == nullptr) return;
+
+    // 두 글리프의 합집합 영역 (pen 기준 좌표)
+    int16_t x0 = 32767, y0 = 32767, x1 = -32768, y1 = -32768;
+    const GFXglyph *both[2] = {a, b};
+    for (int k = 0; k < 2; k++) {
+        const GFXglyph *g = both[k];
+        if (g == nullptr || g->width == 0 || g->height == 0) continue;
+        x0 = min(x0, (int16_t)g->xOffset);
+        y0 = min(y0, (int16_t)g->yOffset);
+        x1 = max(x1, (int16_t)(g->xOffset + g->width));
+        y1 = max(y1, (int16_t)(g->yOffset + g->height));
+    }
+    if (x0 >= x1 || y0 >= y1) return;
+
+    openCount = 0;
+    for (int16_t y = y0; y < y1; y++) {
+        Run row[SEGMENT_MAX_RUNS];
+        uint8_t rowCount = 0;
+
+        int16_t runStart = -1;
+        bool runOn = false;
+        for (int16_t x = x0; x <= x1; x++) {
+            // x == x1 은 마지막 run을 닫기 위한 경계
+            bool was = x < x1 && a != nullptr && pixel(a, x - a->xOffset, y - a->yOffset);
+            bool now = x < x1 && b != nullptr && pixel(b, x - b->xOffset, y - b->yOffset);
+            bool changed = was != now;
+
+            if (runStart >= 0 && (!changed || now != runOn)) {
+                addRun(penX + runStart, baseline + y, x - runStart, runOn, row, rowCount);
+                runStart = -1;
+            }
+            if (changed && runStart < 0) {
+                runStart = x;
+                runOn = now;
+            }
+        }
+
+        closeRow(row, rowCount);
+    }
+
+    for (uint8_t i = 0; i < openCount; i++) {
+        emit(open[i]);
+    }
+    openCount = 0;
+}
+
+void SegmentReadout::addRun(int16_t x, int16_t y, int16_t w, bool on, Run *row, uint8_t &rowCount) {
+    Run r = {x, y, w, 1, on};
+    if (rowCount < SEGMENT_MAX_RUNS) {
+        row[rowCount++] = r;
+    } else {
+        emit(r);
+    }
+}
+
+// 윗 행과 같은 x/폭/색인 run은 세로로 이어 붙이고, 끊긴 사각형은 출력
+void SegmentReadout::closeRow(Run *row, uint8_t rowCount) {
+    bool used[SEGMENT_MAX_RUNS] = {false};
+    Run next[SEGMENT_MAX_RUNS];
+    uint8_t nextCount = 0;
+
+    for (uint8_t i = 0; i < openCount; i++) {
+        Run &r = open[i];
+        bool extended = false;
+        for (uint8_t k = 0; k < rowCount; k++) {
+            if (!used[k] && row[k].x == r.x && row[k].w == r.w && row[k].on == r.on) {
+                used[k] = true;
+                r.h++;
+                next[nextCount++] = r;
+                extended = true;
+                break;
+            }
+        }
+        if (!extended) emit(r);
+    }
+
+    for (uint8_t k = 0; k < rowCount; k++) {
+        if (used[k]) continue;
+        if (nextCount < SEGMENT_MAX_RUNS) {
+            next[nextCount++] = row[k];
+        } else {
+            emit(row[k]);
+        }
+    }
+
+    memcpy(open, next, nextCount * sizeof(Run));
+    openCount = nextCount;
+}
+
+void SegmentReadout::emit(const Run &r) {
+    out->fillRect(r.x, r.y, r.w, r.h, r.on ? fgColor : bgColor);
+    lastRects++;
+    lastPixels += (uint32_t)r.w * r.h;
+}
+
+// ============================================
+// 🆕 Benchmark
+// ============================================
+// 시계에서 실제로 일어나는 숫자 전환을 오프스크린 스프라이트에 BENCH_LOOPS번씩:
+//   1bpp = 세그먼트 diff (바뀌는 세그먼트만 fillRect)
+//   AA   = 바뀐 자리의 2bpp RLE 칸 전체
+//   두 경로 모두 시계와 같은 SegmentReadout::draw → UICanvas 경로
+void SegmentReadout::benchmark(TFT_eSPI *parent, const GFXfont *gfx, const AAFont *aa) {
+    SegmentReadout seg;
+    seg.begin(gfx, 32, 0);
+    seg.begin(gfx, 32, -seg.getTop());      // 칸 위쪽 = 스프라이트 0행
+
+    TFT_eSprite s(parent);
+    s.setColorDepth(16);
+    if (s.createSprite(64, max((int16_t)aa->height, seg.getBottom())) == nullptr) {
+        _PL("AA benchmark: sprite allocation failed");
+        return;
+    }
+    s.fillSprite(TFT_BLACK);
+    UICanvas canvas(&s);
+
+    // 분/초 자리에서 나오는 전환 (세그먼트 변화가 적은 것부터 많은 것까지)
+    const char *steps[] = { "01", "12", "45", "78", "89", "90", "50" };
+
+    _PF("AA benchmark (%u-row cell, per transition: us / px written, 1bpp diff -> AA cell)\n",
+        aa->height);
+    for (uint8_t k = 0; k < sizeof(steps) / sizeof(steps[0]); k++) {
+        String from(steps[k][0]);
+        String to(steps[k][1]);
+        if (AAText::advance(aa, to[0]) == 0) continue;
+
+        seg.setSmoothFont(nullptr);
+        unsigned long t0 = micros();
+        for (int i = 0; i < BENCH_LOOPS; i++) {
+            seg.draw(&canvas, from, to, TFT_WHITE, TFT_BLACK);
+        }
+        unsigned long tDiff = micros() - t0;
+        uint32_t pxDiff = seg.getLastPixelCount();
+
+        seg.setSmoothFont(aa);
+        t0 = micros();
+        for (int i = 0; i < BENCH_LOOPS; i++) {
+            seg.draw(&canvas, from, to, TFT_WHITE, TFT_BLACK);
+        }
+        unsigned long tCell = micros() - t0;
+        uint32_t pxCell = seg.getLastPixelCount();
+
+        _PF("  %c->%c: %lu.%02lu us / %lu px -> %lu.%02lu us / %lu px\n",
+            steps[k][0], steps[k][1],
+            tDiff / BENCH_LOOPS, (tDiff % BENCH_LOOPS) * 100 / BENCH_LOOPS, (unsigned long)pxDiff,
+            tCell / BENCH_LOOPS, (tCell % BENCH_LOOPS) * 100 / BENCH_LOOPS, (unsigned long)pxCell);
+    }
+
+    s.deleteSprite();
+}
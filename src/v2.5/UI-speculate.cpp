@@ -0,0 +1,108 @@
+// ============================================
+// TTGO Watch Speculative Frame Implementation
+// Version: 2.5 - Next-Second Pre-render
+// ============================================
+
+#include "UI-speculate.h"
+
+static const size_t frameBytes = SCREEN_WIDTH * SCREEN_HEIGHT * sizeof(uint16_t);
+
+// ============================================
+// Constructor / Destructor
+// ============================================
+FrameSpeculator::FrameSpeculator() {
+    sprite = nullptr;
+    armed = false;
+    prepareStart = 0;
+    hits = 0;
+    misses = 0;
+    lastCommitUs = 0;
+    lastPrepareUs = 0;
+}
+
+FrameSpeculator::~FrameSpeculator() {
+    end();
+}
+
+bool FrameSpeculator::begin(TFT_eSPI *panel, GlyphCache *glyphs, TextMetricsCache *metrics) {
+    if (sprite != nullptr) return true;
+
+    // 사본 112.5KB - 내부 RAM에는 두지 않음
+    if (!psramFound()) {
+        _PL("Speculation: disabled (needs PSRAM)");
+        return false;
+    }
+
+    sprite = new TFT_eSprite(panel);
+    sprite->setColorDepth(16);
+    if (sprite->createSprite(SCREEN_WIDTH, SCREEN_HEIGHT) == nullptr) {
+        delete sprite;
+        sprite = nullptr;
+        _PL("Speculation: frame allocation failed");
+        return false;
+    }
+
+    canvas.setTarget(sprite);
+    canvas.setDamage(&damage);
+    canvas.setGlyphCache(glyphs);
+    canvas.setMetricsCache(metrics);
+    _PL("Speculation: ready");
+    return true;
+}
+
+void FrameSpeculator::end() {
+    if (sprite != nullptr) {
+        sprite->deleteSprite();
+        delete sprite;
+        sprite = nullptr;
+    }
+    armed = false;
+}
+
+// ============================================
+// Prepare / Commit
+// ============================================
+UICanvas *FrameSpeculator::prepare(TFT_eSprite *live) {
+    if (sprite == nullptr || live == nullptr) return nullptr;
+
+    prepareStart = micros();
+    memcpy(sprite->getPointer(), live->getPointer(), frameBytes);
+    damage.clear();
+    armed = false;
+    return &canvas;
+}
+
+void FrameSpeculator::arm() {
+    armed = true;
+    lastPrepareUs = micros() - prepareStart;
+}
+
+void FrameSpeculator::commit(TFT_eSprite *live, DirtyRegion *liveDamage) {
+    if (!armed) return;
+    uint32_t start = micros();
+
+    const uint16_t *src = (const uint16_t *)sprite->getPointer();
+    uint16_t *dst = (uint16_t *)live->getPointer();
+
+    for (uint8_t i = 0; i < damage.getCount(); i++) {
+        const DirtyRect &r = damage.getRect(i);
+        for (int16_t y = r.y; y < r.bottom(); y++) {
+            size_t offset = (size_t)y * SCREEN_WIDTH + r.x;
+            memcpy(dst + offset, src + offset, r.w * sizeof(uint16_t));
+        }
+        if (liveDamage != nullptr) {
+            liveDamage->add(r.x, r.y, r.w, r.h);
+        }
+    }
+
+    armed = false;
+    hits++;
+    lastCommitUs = micros() - start;
+}
+
+void FrameSpeculator::discard() {
+    if (armed) {
+        misses++;
+    }
+    armed = false;
+}
@@ -0,0 +1,60 @@
+// ============================================
+// TTGO Watch Speculative Frame
+// Version: 2.5 - Next-Second Pre-render
+// ============================================
+#ifndef UI_SPECULATE_H
+#define UI_SPECULATE_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "UI-dirty.h"
+#include "UI-canvas.h"
+
+// ============================================
+// FrameSpeculator
+//   - 초 중간의 남는 시간에 현재 프레임을 PSRAM 사본에 복사하고
+//     다음 초의 바뀌는 부분(초/분 숫자, 베젤)을 미리 그려 둠
+//   - 초가 바뀐 프레임에서 예측이 맞으면 그린 사각형만 행 단위 memcpy
+//     → 렌더링 없이 복사 + push만 남음
+//   - 예측이 틀리거나 화면이 바뀌면 버림 (미스)
+//   - 16bpp 전체 프레임 (PSRAM 합성기 모드) 전용
+// ============================================
+class FrameSpeculator {
+public:
+    FrameSpeculator();
+    ~FrameSpeculator();
+
+    bool begin(TFT_eSPI *panel, GlyphCache *glyphs, TextMetricsCache *metrics);
+    void end();
+    bool isReady() const { return sprite != nullptr; }
+    bool isArmed() const { return armed; }
+
+    // live → 사본 복사 후 예측 프레임을 그릴 캔버스 반환 (손상 영역은 비움)
+    UICanvas *prepare(TFT_eSprite *live);
+    void arm();          // 예측 프레임 완성 → 다음 commit에서 사용
+
+    // 사본의 손상 사각형을 live에 복사하고 liveDamage에 등록
+    void commit(TFT_eSprite *live, DirtyRegion *liveDamage);
+    void discard();
+
+    // 통계
+    uint32_t getHits() const { return hits; }
+    uint32_t getMisses() const { return misses; }
+    uint32_t getLastCommitUs() const { return lastCommitUs; }
+    uint32_t getLastPrepareUs() const { return lastPrepareUs; }
+    void resetStats() { hits = 0; misses = 0; }
+
+private:
+    TFT_eSprite *sprite;    // 240x240 16bpp (PSRAM)
+    UICanvas canvas;        // 사본에 즉시 그림 (목록 기록 없음)
+    DirtyRegion damage;     // 예측 프레임이 건드린 영역
+    bool armed;
+    uint32_t prepareStart;
+
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t lastCommitUs;
+    uint32_t lastPrepareUs;
+};
+
+#endif // UI_SPECULATE_H
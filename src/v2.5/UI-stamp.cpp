@@ -0,0 +1,149 @@
+// ============================================
+// TTGO Watch Dot Stamps Implementation
+// Version: 2.5 - Span-table Circles
+// ============================================
+
+#include "UI-stamp.h"
+
+#define STAMP_SIDE      (2 * STAMP_MAX_RADIUS + 1)
+#define BENCH_LOOPS     1000
+
+int8_t DotStamp::half[STAMP_MAX_RADIUS + 1][STAMP_MAX_RADIUS + 1];
+bool DotStamp::built = false;
+
+// ============================================
+// Span Table
+// ============================================
+// TFT_eSPI fillCircle의 수평선 순서를 그대로 따라가며 행별 최대 반폭 기록
+void DotStamp::build() {
+    for (int32_t r0 = 0; r0 <= STAMP_MAX_RADIUS; r0++) {
+        int8_t *h = half[r0];
+        for (int32_t i = 0; i <= STAMP_MAX_RADIUS; i++) h[i] = -1;
+
+        int32_t r = r0;
+        int32_t x = 0;
+        int32_t dx = 1;
+        int32_t dy = r + r;
+        int32_t p = -(r >> 1);
+
+        h[0] = r;
+        while (x < r) {
+            if (p >= 0) {
+                // drawFastHLine(x0 - x, y0 ± r, dx): 폭 dx = 2x + 1
+                h[r] = max(h[r], (int8_t)x);
+                dy -= 2;
+                p -= dy;
+                r--;
+            }
+            dx += 2;
+            p += dx;
+            x++;
+            h[x] = max(h[x], (int8_t)r);
+        }
+    }
+    built = true;
+}
+
+int8_t DotStamp::halfWidth(uint8_t r, uint8_t dy) {
+    if (!built) build();
+    if (r > STAMP_MAX_RADIUS || dy > r) return -1;
+    return half[r][dy];
+}
+
+// ============================================
+// Draw
+// ============================================
+void DotStamp::fill(TFT_eSPI *tft, int32_t x, int32_t y, int32_t r, uint32_t color) {
+    if (!built) build();
+
+    const int8_t *h = half[r];
+    tft->drawFastHLine(x - h[0], y, 2 * h[0] + 1, color);
+    for (int32_t dy = 1; dy <= r; dy++) {
+        if (h[dy] < 0) continue;
+        tft->drawFastHLine(x - h[dy], y - dy, 2 * h[dy] + 1, color);
+        tft->drawFastHLine(x - h[dy], y + dy, 2 * h[dy] + 1, color);
+    }
+}
+
+void DotStamp::stamp(TFT_eSPI *tft, int32_t x, int32_t y, int32_t r, uint16_t color, uint16_t bg) {
+    if (!built) build();
+
+    // 스프라이트 버퍼 순서 (바이트 스왑)로 블록 구성
+    uint16_t block[STAMP_SIDE * STAMP_SIDE];
+    uint16_t on = (color >> 8) | (color << 8);
+    uint16_t off = (bg >> 8) | (bg << 8);
+    int32_t side = 2 * r + 1;
+
+    const int8_t *h = half[r];
+    for (int32_t j = 0; j < side; j++) {
+        int32_t w = h[abs(j - r)];
+        uint16_t *row = block + j * side;
+        for (int32_t i = 0; i < side; i++) {
+            row[i] = abs(i - r) <= w ? on : off;
+        }
+    }
+
+    bool oldSwap = tft->getSwapBytes();
+    tft->setSwapBytes(false);
+    tft->pushImage(x - r, y - r, side, side, block);
+    tft->setSwapBytes(oldSwap);
+}
+
+// ============================================
+// 🆕 Benchmark
+// ============================================
+// 오프스크린 스프라이트에 같은 점을 BENCH_LOOPS번 그려 시간 비교 + fillCircle과 픽셀 비교
+void DotStamp::benchmark(TFT_eSPI *parent) {
+    TFT_eSprite a(parent);
+    TFT_eSprite b(parent);
+    a.setColorDepth(16);
+    b.setColorDepth(16);
+    if (a.createSprite(STAMP_SIDE, STAMP_SIDE) == nullptr ||
+        b.createSprite(STAMP_SIDE, STAMP_SIDE) == nullptr) {
+        _PL("DotStamp benchmark: sprite allocation failed");
+        return;
+    }
+
+    const int32_t c = STAMP_MAX_RADIUS;
+    const uint8_t radii[] = { 1, 2, 6, 7 };
+
+    _PL("DotStamp benchmark (us per dot: fillCircle / spans / stamp)");
+    for (uint8_t k = 0; k < sizeof(radii); k++) {
+        int32_t r = radii[k];
+        if (!supports(r)) continue;
+
+        unsigned long t0 = micros();
+        for (int i = 0; i < BENCH_LOOPS; i++) a.fillCircle(c, c, r, TFT_WHITE);
+        unsigned long tCircle = micros() - t0;
+
+        t0 = micros();
+        for (int i = 0; i < BENCH_LOOPS; i++) fill(&b, c, c, r, TFT_WHITE);
+        unsigned long tSpans = micros() - t0;
+
+        t0 = micros();
+        for (int i = 0; i < BENCH_LOOPS; i++) stamp(&b, c, c, r, TFT_WHITE, TFT_BLACK);
+        unsigned long tStamp = micros() - t0;
+
+        // 모양 확인: 같은 배경에 fillCircle / spans
+        a.fillSprite(TFT_BLACK);
+        b.fillSprite(TFT_BLACK);
+        a.fillCircle(c, c, r, TFT_WHITE);
+        fill(&b, c, c, r, TFT_WHITE);
+
+        uint16_t diff = 0;
+        for (int32_t py = 0; py < STAMP_SIDE; py++) {
+            for (int32_t px = 0; px < STAMP_SIDE; px++) {
+                if (a.readPixel(px, py) != b.readPixel(px, py)) diff++;
+            }
+        }
+
+        _PF("  r=%ld: %lu.%02lu / %lu.%02lu / %lu.%02lu, %u px differ\n", (long)r,
+            tCircle / BENCH_LOOPS, (tCircle % BENCH_LOOPS) / 10,
+            tSpans / BENCH_LOOPS, (tSpans % BENCH_LOOPS) / 10,
+            tStamp / BENCH_LOOPS, (tStamp % BENCH_LOOPS) / 10,
+            diff);
+    }
+
+    a.deleteSprite();
+    b.deleteSprite();
+}
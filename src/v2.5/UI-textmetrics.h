@@ -0,0 +1,65 @@
+// ============================================
+// TTGO Watch Text Metrics Cache
+// Version: 2.5 - Cached Datum Alignment
+// ============================================
+#ifndef UI_TEXTMETRICS_H
+#define UI_TEXTMETRICS_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// ============================================
+// TextMetricsCache
+//   - (폰트, 크기, 문자열) → 픽셀 폭/높이를 한 번만 측정
+//   - datum 정렬과 손상 영역 계산이 매 프레임 글리프를 다시 세지 않음
+//   - 4-way 집합 연관 (FNV-1a 해시), 집합 안에서 LRU 교체
+//   - TEXT_METRICS_MAX_LEN보다 긴 문자열은 캐시하지 않음 (호출자가 직접 측정)
+// ============================================
+class TextMetricsCache {
+public:
+    TextMetricsCache();
+
+    // 폰트 키: Free Font 포인터 + 내장 폰트 번호 + textSize
+    bool lookup(const char *str, const void *face, uint8_t font, uint8_t size,
+                int16_t &w, int16_t &h);
+    void store(const char *str, const void *face, uint8_t font, uint8_t size,
+               int16_t w, int16_t h);
+    void clear();
+
+    // 통계 (크기 조정용)
+    uint32_t getHits() const { return hits; }
+    uint32_t getMisses() const { return misses; }
+    uint32_t getEvictions() const { return evictions; }
+    uint8_t getUsedSlots() const;
+    void resetStats();
+
+private:
+    static const uint8_t WAYS = 4;
+
+    struct Slot {
+        bool used;
+        uint8_t font;
+        uint8_t size;
+        uint8_t len;
+        int16_t w;
+        int16_t h;
+        uint32_t hash;
+        uint32_t lastUse;
+        const void *face;
+        char str[TEXT_METRICS_MAX_LEN + 1];
+    };
+
+    Slot slots[TEXT_METRICS_SLOTS];
+    uint32_t useClock;
+
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t evictions;
+
+    static uint32_t hashOf(const char *str, size_t len, const void *face, uint8_t font, uint8_t size);
+    static uint8_t setOf(uint32_t hash) { return (hash % (TEXT_METRICS_SLOTS / WAYS)) * WAYS; }
+    int findSlot(const char *str, size_t len, uint32_t hash, const void *face, uint8_t font, uint8_t size) const;
+    int victimSlot(uint32_t hash);
+};
+
+#endif // UI_TEXTMETRICS_H
@@ -0,0 +1,164 @@
+// ============================================
+// TTGO Watch Retained Widgets Implementation
+// Version: 2.5 - Widget Layer
+// ============================================
+
+#include "UI-widget.h"
+
+// ============================================
+// Widget
+// ============================================
+Widget::Widget(int16_t x, int16_t y, int16_t w, int16_t h)
+    : x(x), y(y), w(w), h(h), dirty(true) {
+}
+
+bool Widget::render(UICanvas *tft) {
+    if (!dirty) return false;
+    paint(tft);
+    dirty = false;
+    return true;
+}
+
+// ============================================
+// Box
+// ============================================
+Box::Box(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color, bool filled)
+    : Widget(x, y, w, h), color(color), filled(filled) {
+}
+
+void Box::paint(UICanvas *tft) {
+    if (filled) {
+        tft->fillRect(x, y, w, h, color);
+    } else {
+        tft->drawRect(x, y, w, h, color);
+    }
+}
+
+// ============================================
+// Label
+// ============================================
+Label::Label(int16_t cx, int16_t cy, int16_t boxW, int16_t boxH,
+             const String &text, uint8_t font, uint16_t fg, uint16_t bg)
+    : Widget(cx - boxW / 2, cy - boxH / 2, boxW, boxH),
+      cx(cx), cy(cy), text(text), font(font), gfx(nullptr), fg(fg), bg(bg) {
+}
+
+Label::Label(int16_t cx, int16_t cy, const String &text,
+             const GFXfont *gfxFont, uint16_t fg, uint16_t bg)
+    : Widget(cx, cy, 0, 0),
+      cx(cx), cy(cy), text(text), font(1), gfx(gfxFont), fg(fg), bg(bg) {
+}
+
+void Label::setText(const String &t) {
+    if (t == text) return;
+    text = t;
+    invalidate();
+}
+
+void Label::setColor(uint16_t c) {
+    if (c == fg) return;
+    fg = c;
+    invalidate();
+}
+
+void Label::paint(UICanvas *tft) {
+    if (w > 0 && h > 0) {
+        tft->fillRect(x, y, w, h, bg);
+    }
+
+    tft->setTextDatum(MC_DATUM);
+    tft->setTextColor(fg, bg);
+    if (gfx != nullptr) {
+        tft->setFreeFont(gfx);
+        tft->drawString(text, cx, cy);
+        tft->setFreeFont(NULL);
+    } else {
+        tft->drawString(text, cx, cy, font);
+    }
+}
+
+// ============================================
+// ValueField
+// ============================================
+ValueField::ValueField(int16_t cx, int16_t cy, int16_t boxW, int16_t boxH,
+                       uint8_t font, uint16_t fg, uint16_t bg, const char *suffix)
+    : Label(cx, cy, boxW, boxH, "", font, fg, bg), suffix(suffix) {
+}
+
+void ValueField::setValue(int value) {
+    setText(String(value) + suffix);
+}
+
+void ValueField::setValue(float value, uint8_t decimals) {
+    setText(String(value, (unsigned int)decimals) + suffix);
+}
+
+// ============================================
+// Button
+// ============================================
+Button::Button(int16_t x, int16_t y, int16_t w, int16_t h,
+               const String &caption, uint8_t font, uint16_t color, uint16_t bg)
+    : Widget(x, y, w, h), caption(caption), font(font), color(color), bg(bg) {
+}
+
+void Button::paint(UICanvas *tft) {
+    tft->drawRect(x, y, w, h, color);
+    tft->setTextDatum(MC_DATUM);
+    tft->setTextColor(color, bg);
+    tft->drawString(caption, x + w / 2, y + h / 2, font);
+}
+
+// ============================================
+// ProgressBar
+// ============================================
+ProgressBar::ProgressBar(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t outline, uint16_t bg)
+    : Widget(x, y, w, h), outline(outline), bg(bg), fillColor(bg), value(0) {
+}
+
+void ProgressBar::setValue(int percent, uint16_t color) {
+    percent = constrain(percent, 0, 100);
+    if (percent == value && color == fillColor) return;
+    value = percent;
+    fillColor = color;
+    invalidate();
+}
+
+void ProgressBar::paint(UICanvas *tft) {
+    int16_t innerW = w - 4;
+    int16_t fillW = (int32_t)innerW * value / 100;
+
+    tft->drawRect(x, y, w, h, outline);
+    if (fillW > 0) {
+        tft->fillRect(x + 2, y + 2, fillW, h - 4, fillColor);
+    }
+    if (fillW < innerW) {
+        tft->fillRect(x + 2 + fillW, y + 2, innerW - fillW, h - 4, bg);
+    }
+}
+
+// ============================================
+// WidgetScreen
+// ============================================
+WidgetScreen::WidgetScreen() {
+    count = 0;
+}
+
+WidgetScreen::~WidgetScreen() {
+    for (uint8_t i = 0; i < count; i++) {
+        delete items[i];
+    }
+}
+
+void WidgetScreen::invalidateAll() {
+    for (uint8_t i = 0; i < count; i++) {
+        items[i]->invalidate();
+    }
+}
+
+uint8_t WidgetScreen::render(UICanvas *tft) {
+    uint8_t painted = 0;
+    for (uint8_t i = 0; i < count; i++) {
+        if (items[i]->render(tft)) painted++;
+    }
+    return painted;
+}
@@ -0,0 +1,164 @@
+// ============================================
+// TTGO Watch Retained Widgets
+// Version: 2.5 - Widget Layer
+// ============================================
+#ifndef UI_WIDGET_H
+#define UI_WIDGET_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "UI-canvas.h"
+
+#define WIDGET_SCREEN_MAX   20      // 화면당 위젯 최대 개수
+
+// ============================================
+// Widget
+//   - 화면에 남아 있는 요소 하나 (위치/크기 고정)
+//   - 값이 바뀔 때만 invalidate → render()에서 다시 그림
+// ============================================
+class Widget {
+public:
+    Widget(int16_t x, int16_t y, int16_t w, int16_t h);
+    virtual ~Widget() {}
+
+    void invalidate() { dirty = true; }
+    bool isDirty() const { return dirty; }
+
+    // 더러울 때만 그림, 그렸으면 true
+    bool render(UICanvas *tft);
+
+    // 터치 판정 (크기가 0인 위젯은 항상 false)
+    bool contains(int16_t px, int16_t py) const {
+        return px >= x && px < x + w && py >= y && py < y + h;
+    }
+
+protected:
+    int16_t x, y, w, h;
+    bool dirty;
+
+    virtual void paint(UICanvas *tft) = 0;
+};
+
+// ============================================
+// Box - 고정 장식 (테두리 또는 채운 사각형)
+// ============================================
+class Box : public Widget {
+public:
+    Box(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color, bool filled = false);
+
+protected:
+    void paint(UICanvas *tft) override;
+
+private:
+    uint16_t color;
+    bool filled;
+};
+
+// ============================================
+// Label - MC_DATUM 텍스트
+//   boxW/boxH > 0 이면 (cx, cy) 중심 영역을 bg로 지운 뒤 그림 (값이 바뀌는 라벨)
+// ============================================
+class Label : public Widget {
+public:
+    Label(int16_t cx, int16_t cy, int16_t boxW, int16_t boxH,
+          const String &text, uint8_t font, uint16_t fg, uint16_t bg);
+    Label(int16_t cx, int16_t cy, const String &text,
+          const GFXfont *gfxFont, uint16_t fg, uint16_t bg);
+
+    void setText(const String &t);
+    void setColor(uint16_t fg);
+    const String &getText() const { return text; }
+
+protected:
+    void paint(UICanvas *tft) override;
+
+private:
+    int16_t cx, cy;
+    String text;
+    uint8_t font;
+    const GFXfont *gfx;
+    uint16_t fg, bg;
+};
+
+// ============================================
+// ValueField - 숫자 값에 묶인 라벨 (표시 문자열이 바뀔 때만 다시 그림)
+// ============================================
+class ValueField : public Label {
+public:
+    ValueField(int16_t cx, int16_t cy, int16_t boxW, int16_t boxH,
+               uint8_t font, uint16_t fg, uint16_t bg, const char *suffix = "");
+
+    void setValue(int value);
+    void setValue(float value, uint8_t decimals);
+
+private:
+    const char *suffix;
+};
+
+// ============================================
+// Button - 테두리 + 가운데 캡션
+// ============================================
+class Button : public Widget {
+public:
+    Button(int16_t x, int16_t y, int16_t w, int16_t h,
+           const String &caption, uint8_t font, uint16_t color, uint16_t bg);
+
+protected:
+    void paint(UICanvas *tft) override;
+
+private:
+    String caption;
+    uint8_t font;
+    uint16_t color, bg;
+};
+
+// ============================================
+// ProgressBar - 1px 테두리 + 1px 여백 + 채움 (0~100)
+// ============================================
+class ProgressBar : public Widget {
+public:
+    ProgressBar(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t outline, uint16_t bg);
+
+    void setValue(int percent, uint16_t color);
+
+protected:
+    void paint(UICanvas *tft) override;
+
+private:
+    uint16_t outline, bg;
+    uint16_t fillColor;
+    int value;
+};
+
+// ============================================
+// WidgetScreen - 한 화면의 위젯 목록 (소유)
+// ============================================
+class WidgetScreen {
+public:
+    WidgetScreen();
+    ~WidgetScreen();
+
+    template <class T>
+    T *add(T *widget) {
+        if (count >= WIDGET_SCREEN_MAX) {
+            delete widget;
+            return nullptr;
+        }
+        items[count++] = widget;
+        return widget;
+    }
+
+    bool isBuilt() const { return count > 0; }
+
+    // 화면이 지워졌을 때 - 전부 다시 그림
+    void invalidateAll();
+
+    // 더러운 위젯만 그림, 그린 개수 반환 (0이면 SPI 전송 없음)
+    uint8_t render(UICanvas *tft);
+
+private:
+    Widget *items[WIDGET_SCREEN_MAX];
+    uint8_t count;
+};
+
+#endif // UI_WIDGET_H
@@ -1,804 +1,274 @@
+// ============================================
+// TTGO Watch Fonts (생성 파일 - 직접 수정하지 말 것)
+// tools/font_subset.py가 tools/fonts_full.h에서 쓰는 글자만 추출
+// ============================================
 #ifndef FONTS_H
 #define FONTS_H
 
-// Created by http://oleddisplay.squix.ch/ Consider a donation
-// In case of problems make sure that you are using the font file with the correct version!
-const uint8_t DSEG7_Modern_Bold_20Bitmaps[] PROGMEM = {
-
-  // Bitmap Data:
-  0x00, // ' '
-  0x00, // '!'
-  0xFD,0x0A,0x14,0x28,0x50,0xA1,0x42,0x85,0x0A,0x14,0x28,0x5F,0x80, // '"'
-  0xFD,0x0A,0x14,0x28,0x50,0xA1,0x42,0x85,0x0A,0x14,0x28,0x5F,0x80, // '#'
-  0xFD,0x0A,0x14,0x28,0x50,0xA1,0x42,0x85,0x0A,0x14,0x28,0x5F,0x80, // '$'
-  0xFD,0x0A,0x14,0x28,0x50,0xA1,0x42,0x85,0x0A,0x14,0x28,0x5F,0x80, // '%'
-  0xFD,0x0A,0x14,0x28,0x50,0xA1,0x42,0x85,0x0A,0x14,0x28,0x5F,0x80, // '&'
-  0xFD,0x0A,0x14,0x28,0x50,0xA1,0x42,0x85,0x0A,0x14,0x28,0x5F,0x80, // '''
-  0xFD,0x0A,0x14,0x28,0x50,0xA1,0x42,0x85,0x0A,0x14,0x28,0x5F,0x80, // '('
-  0xFD,0x0A,0x14,0x28,0x50,0xA1,0x42,0x85,0x0A,0x14,0x28,0x5F,0x80, // ')'
-  0xFD,0x0A,0x14,0x28,0x50,0xA1,0x42,0x85,0x0A,0x14,0x28,0x5F,0x80, // '*'
-  0xFD,0x0A,0x14,0x28,0x50,0xA1,0x42,0x85,0x0A,0x14,0x28,0x5F,0x80, // '+'
-  0xFD,0x0A,0x14,0x28,0x50,0xA1,0x42,0x85,0x0A,0x14,0x28,0x5F,0x80, // ','
-  0xFF,0x3F,0xC0, // '-'
-  0xD8, // '.'
-  0xFD,0x0A,0x14,0x28,0x50,0xA1,0x42,0x85,0x0A,0x14,0x28,0x5F,0x80, // '/'
-  0xFF,0xE5,0xFE,0xB0,0x0D,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x36,0x00,0x00,0x0D,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x36,0x01,0xAF,0xF9,0xFF,0xE0, // '0'
-  0x0B,0x6D,0xB6,0xC3,0x6D,0xB6,0xD8,0x00, // '1'
-  0xFF,0xE1,0xFE,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x06,0x00,0x31,0xFE,0x0F,0xF1,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x06,0x00,0x2F,0xF9,0xFF,0xE0, // '2'
-  0xFF,0xE1,0xFE,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x06,0x00,0x31,0xFE,0x0F,0xFC,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x06,0x00,0x30,0x01,0x8F,0xF8,0xFF,0xE0, // '3'
-  0x00,0x04,0x00,0xB0,0x0D,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x37,0xFE,0x0F,0xFC,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x06,0x00,0x30,0x01,0x80,0x00, // '4'
-  0xFF,0xE5,0xFE,0x30,0x01,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x07,0xFE,0x0F,0xFC,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x06,0x00,0x30,0x01,0x8F,0xF8,0xFF,0xE0, // '5'
-  0xFF,0xE5,0xFE,0x30,0x01,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x07,0xFE,0x0F,0xFD,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x36,0x01,0xAF,0xF9,0xFF,0xE0, // '6'
-  0xFF,0xE5,0xFE,0xB0,0x0D,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x36,0x00,0x00,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x06,0x00,0x30,0x01,0x80,0x00, // '7'
-  0xFF,0xE5,0xFE,0xB0,0x0D,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x37,0xFE,0x0F,0xFD,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x36,0x01,0xAF,0xF9,0xFF,0xE0, // '8'
-  0xFF,0xE5,0xFE,0xB0,0x0D,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x37,0xFE,0x0F,0xFC,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x06,0x00,0x30,0x01,0x8F,0xF8,0xFF,0xE0, // '9'
-  0xD8,0x00,0x00,0xDB,0x00, // ':'
-  0xFD,0x0A,0x14,0x28,0x50,0xA1,0x42,0x85,0x0A,0x14,0x28,0x5F,0x80, // ';'
-  0xFD,0x0A,0x14,0x28,0x50,0xA1,0x42,0x85,0x0A,0x14,0x28,0x5F,0x80, // '<'
-  0xFD,0x0A,0x14,0x28,0x50,0xA1,0x42,0x85,0x0A,0x14,0x28,0x5F,0x80, // '='
-  0xFD,0x0A,0x14,0x28,0x50,0xA1,0x42,0x85,0x0A,0x14,0x28,0x5F,0x80, // '>'
-  0xFD,0x0A,0x14,0x28,0x50,0xA1,0x42,0x85,0x0A,0x14,0x28,0x5F,0x80, // '?'
-  0xFD,0x0A,0x14,0x28,0x50,0xA1,0x42,0x85,0x0A,0x14,0x28,0x5F,0x80, // '@'
-  0xFF,0xE5,0xFE,0xB0,0x0D,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x37,0xFE,0x0F,0xFD,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x36,0x01,0xA0,0x01,0x00,0x00, // 'A'
-  0x80,0x06,0x00,0x30,0x01,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0xFF,0xC1,0xFF,0xB0,0x0D,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x35,0xFF,0x3F,0xFC, // 'B'
-  0x3F,0xC1,0xFE,0x30,0x01,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x05,0xFF,0x3F,0xFC, // 'C'
-  0x00,0x00,0x00,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x06,0x00,0x31,0xFE,0x0F,0xFD,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x36,0x01,0xAF,0xF9,0xFF,0xE0, // 'D'
-  0xFF,0xE5,0xFE,0x30,0x01,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x07,0xFE,0x0F,0xF1,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x06,0x00,0x2F,0xF9,0xFF,0xE0, // 'E'
-  0xFF,0xEB,0xFC,0xC0,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x0F,0xFC,0x3F,0xCC,0x00,0xC0,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x0C,0x00,0x80,0x08,0x00, // 'F'
-  0xFF,0xE5,0xFE,0x30,0x01,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x06,0x00,0x00,0x0D,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x36,0x01,0xAF,0xF9,0xFF,0xE0, // 'G'
-  0x80,0x06,0x00,0x30,0x01,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0xFF,0xC1,0xFF,0xB0,0x0D,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x34,0x00,0x20,0x00, // 'H'
-  0x1B,0x6D,0xB6,0xC0, // 'I'
-  0x00,0x00,0x00,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x06,0x00,0x30,0x00,0x00,0x0D,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x36,0x01,0xAF,0xF9,0xFF,0xE0, // 'J'
-  0xFF,0xE5,0xFE,0x30,0x01,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x07,0xFE,0x0F,0xFD,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x36,0x01,0xA0,0x01,0x00,0x00, // 'K'
-  0x80,0x06,0x00,0x30,0x01,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x00,0x00,0x30,0x01,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x05,0xFF,0x3F,0xFC, // 'L'
-  0xFF,0xE5,0xFE,0xB0,0x0D,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x36,0x00,0x00,0x0D,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x36,0x01,0xA0,0x01,0x00,0x00, // 'M'
-  0x3F,0xC1,0xFF,0xB0,0x0D,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x34,0x00,0x20,0x00, // 'N'
-  0x3F,0xC1,0xFF,0xB0,0x0D,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x35,0xFF,0x3F,0xFC, // 'O'
-  0xFF,0xE5,0xFE,0xB0,0x0D,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x37,0xFE,0x0F,0xF1,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x06,0x00,0x20,0x01,0x00,0x00, // 'P'
-  0xFF,0xE5,0xFE,0xB0,0x0D,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x37,0xFE,0x0F,0xFC,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x06,0x00,0x30,0x01,0x80,0x00, // 'Q'
-  0x3F,0xC3,0xFC,0xC0,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x08,0x00,0x80,0x00, // 'R'
-  0x80,0x06,0x00,0x30,0x01,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0xFF,0xC1,0xFF,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x06,0x00,0x31,0xFF,0x1F,0xFC, // 'S'
-  0x80,0x06,0x00,0x30,0x01,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0xFF,0xC1,0xFE,0x30,0x01,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x05,0xFF,0x3F,0xFC, // 'T'
-  0x00,0x00,0x01,0xB0,0x0D,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x35,0xFF,0x3F,0xFC, // 'U'
-  0x00,0x04,0x00,0xB0,0x0D,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x36,0x00,0x00,0x0D,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x36,0x01,0xAF,0xF9,0xFF,0xE0, // 'V'
-  0x00,0x04,0x00,0xB0,0x0D,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x37,0xFE,0x0F,0xFD,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x36,0x01,0xAF,0xF9,0xFF,0xE0, // 'W'
-  0x00,0x04,0x00,0xB0,0x0D,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x37,0xFE,0x0F,0xFD,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x36,0x01,0xA0,0x01,0x00,0x00, // 'X'
-  0x00,0x04,0x00,0xB0,0x0D,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x37,0xFE,0x0F,0xFC,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x06,0x00,0x30,0x01,0x8F,0xF8,0xFF,0xE0, // 'Y'
-  0xFF,0xE1,0xFE,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x06,0x00,0x30,0x00,0x00,0x01,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x06,0x00,0x2F,0xF9,0xFF,0xE0, // 'Z'
-  0xFD,0x0A,0x14,0x28,0x50,0xA1,0x42,0x85,0x0A,0x14,0x28,0x5F,0x80, // '['
-  0xFD,0x0A,0x14,0x28,0x50,0xA1,0x42,0x85,0x0A,0x14,0x28,0x5F,0x80, // '\'
-  0xFD,0x0A,0x14,0x28,0x50,0xA1,0x42,0x85,0x0A,0x14,0x28,0x5F,0x80, // ']'
-  0xFD,0x0A,0x14,0x28,0x50,0xA1,0x42,0x85,0x0A,0x14,0x28,0x5F,0x80, // '^'
-  0xFD,0x0A,0x14,0x28,0x50,0xA1,0x42,0x85,0x0A,0x14,0x28,0x5F,0x80, // '_'
-  0xFD,0x0A,0x14,0x28,0x50,0xA1,0x42,0x85,0x0A,0x14,0x28,0x5F,0x80, // '`'
-  0xFF,0xE5,0xFE,0xB0,0x0D,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x37,0xFE,0x0F,0xFD,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x36,0x01,0xA0,0x01,0x00,0x00, // 'a'
-  0x80,0x06,0x00,0x30,0x01,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0xFF,0xC1,0xFF,0xB0,0x0D,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x35,0xFF,0x3F,0xFC, // 'b'
-  0x3F,0xC1,0xFE,0x30,0x01,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x05,0xFF,0x3F,0xFC, // 'c'
-  0x00,0x00,0x00,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x06,0x00,0x31,0xFE,0x0F,0xFD,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x36,0x01,0xAF,0xF9,0xFF,0xE0, // 'd'
-  0xFF,0xE5,0xFE,0x30,0x01,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x07,0xFE,0x0F,0xF1,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x06,0x00,0x2F,0xF9,0xFF,0xE0, // 'e'
-  0xFF,0xEB,0xFC,0xC0,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x0F,0xFC,0x3F,0xCC,0x00,0xC0,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x0C,0x00,0x80,0x08,0x00, // 'f'
-  0xFF,0xE5,0xFE,0x30,0x01,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x06,0x00,0x00,0x0D,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x36,0x01,0xAF,0xF9,0xFF,0xE0, // 'g'
-  0x80,0x06,0x00,0x30,0x01,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0xFF,0xC1,0xFF,0xB0,0x0D,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x34,0x00,0x20,0x00, // 'h'
-  0x1B,0x6D,0xB6,0xC0, // 'i'
-  0x00,0x00,0x00,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x06,0x00,0x30,0x00,0x00,0x0D,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x36,0x01,0xAF,0xF9,0xFF,0xE0, // 'j'
-  0xFF,0xE5,0xFE,0x30,0x01,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x07,0xFE,0x0F,0xFD,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x36,0x01,0xA0,0x01,0x00,0x00, // 'k'
-  0x80,0x06,0x00,0x30,0x01,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x00,0x00,0x30,0x01,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x05,0xFF,0x3F,0xFC, // 'l'
-  0xFF,0xE5,0xFE,0xB0,0x0D,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x36,0x00,0x00,0x0D,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x36,0x01,0xA0,0x01,0x00,0x00, // 'm'
-  0x3F,0xC1,0xFF,0xB0,0x0D,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x34,0x00,0x20,0x00, // 'n'
-  0x3F,0xC1,0xFF,0xB0,0x0D,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x35,0xFF,0x3F,0xFC, // 'o'
-  0xFF,0xE5,0xFE,0xB0,0x0D,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x37,0xFE,0x0F,0xF1,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x06,0x00,0x20,0x01,0x00,0x00, // 'p'
-  0xFF,0xE5,0xFE,0xB0,0x0D,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x37,0xFE,0x0F,0xFC,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x06,0x00,0x30,0x01,0x80,0x00, // 'q'
-  0x3F,0xC3,0xFC,0xC0,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x08,0x00,0x80,0x00, // 'r'
-  0x80,0x06,0x00,0x30,0x01,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0xFF,0xC1,0xFF,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x06,0x00,0x31,0xFF,0x1F,0xFC, // 's'
-  0x80,0x06,0x00,0x30,0x01,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0xFF,0xC1,0xFE,0x30,0x01,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x05,0xFF,0x3F,0xFC, // 't'
-  0x00,0x00,0x01,0xB0,0x0D,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x35,0xFF,0x3F,0xFC, // 'u'
-  0x00,0x04,0x00,0xB0,0x0D,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x36,0x00,0x00,0x0D,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x36,0x01,0xAF,0xF9,0xFF,0xE0, // 'v'
-  0x00,0x04,0x00,0xB0,0x0D,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x37,0xFE,0x0F,0xFD,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x36,0x01,0xAF,0xF9,0xFF,0xE0, // 'w'
-  0x00,0x04,0x00,0xB0,0x0D,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x37,0xFE,0x0F,0xFD,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x36,0x01,0xA0,0x01,0x00,0x00, // 'x'
-  0x00,0x04,0x00,0xB0,0x0D,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x37,0xFE,0x0F,0xFC,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x06,0x00,0x30,0x01,0x8F,0xF8,0xFF,0xE0, // 'y'
-  0xFF,0xE1,0xFE,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x06,0x00,0x30,0x00,0x00,0x01,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x06,0x00,0x2F,0xF9,0xFF,0xE0, // 'z'
-  0xFD,0x0A,0x14,0x28,0x50,0xA1,0x42,0x85,0x0A,0x14,0x28,0x5F,0x80, // '{'
-  0xFD,0x0A,0x14,0x28,0x50,0xA1,0x42,0x85,0x0A,0x14,0x28,0x5F,0x80, // '|'
-  0xFD,0x0A,0x14,0x28,0x50,0xA1,0x42,0x85,0x0A,0x14,0x28,0x5F,0x80 // '}'
-};
-const GFXglyph DSEG7_Modern_Bold_20Glyphs[] PROGMEM = {
-// bitmapOffset, width, height, xAdvance, xOffset, yOffset
-    {     0,   1,   1,   5,    0,    0 }, // ' '
-    {     1,   1,   1,  17,    0,    0 }, // '!'
-    {     2,   7,  14,   8,    1,  -14 }, // '"'
-    {    15,   7,  14,   8,    1,  -14 }, // '#'
-    {    28,   7,  14,   8,    1,  -14 }, // '$'
-    {    41,   7,  14,   8,    1,  -14 }, // '%'
-    {    54,   7,  14,   8,    1,  -14 }, // '&'
-    {    67,   7,  14,   8,    1,  -14 }, // '''
-    {    80,   7,  14,   8,    1,  -14 }, // '('
-    {    93,   7,  14,   8,    1,  -14 }, // ')'
-    {   106,   7,  14,   8,    1,  -14 }, // '*'
-    {   119,   7,  14,   8,    1,  -14 }, // '+'
-    {   132,   7,  14,   8,    1,  -14 }, // ','
-    {   145,  10,   2,  17,    4,  -11 }, // '-'
-    {   148,   3,   2,   1,   -1,   -2 }, // '.'
-    {   149,   7,  14,   8,    1,  -14 }, // '/'
-    {   162,  13,  20,  17,    2,  -20 }, // '0'
-    {   195,   3,  19,  17,   12,  -20 }, // '1'
-    {   203,  13,  20,  17,    2,  -20 }, // '2'
-    {   236,  13,  20,  17,    2,  -20 }, // '3'
-    {   269,  13,  19,  17,    2,  -20 }, // '4'
-    {   300,  13,  20,  17,    2,  -20 }, // '5'
-    {   333,  13,  20,  17,    2,  -20 }, // '6'
-    {   366,  13,  19,  17,    2,  -20 }, // '7'
-    {   397,  13,  20,  17,    2,  -20 }, // '8'
-    {   430,  13,  20,  17,    2,  -20 }, // '9'
-    {   463,   3,  11,   5,    1,  -15 }, // ':'
-    {   468,   7,  14,   8,    1,  -14 }, // ';'
-    {   481,   7,  14,   8,    1,  -14 }, // '<'
-    {   494,   7,  14,   8,    1,  -14 }, // '='
-    {   507,   7,  14,   8,    1,  -14 }, // '>'
-    {   520,   7,  14,   8,    1,  -14 }, // '?'
-    {   533,   7,  14,   8,    1,  -14 }, // '@'
-    {   546,  13,  20,  17,    2,  -20 }, // 'A'
-    {   579,  13,  19,  17,    2,  -19 }, // 'B'
-    {   610,  13,  11,  17,    2,  -11 }, // 'C'
-    {   628,  13,  20,  17,    2,  -20 }, // 'D'
-    {   661,  13,  20,  17,    2,  -20 }, // 'E'
-    {   694,  12,  20,  17,    2,  -20 }, // 'F'
-    {   724,  13,  20,  17,    2,  -20 }, // 'G'
-    {   757,  13,  19,  17,    2,  -19 }, // 'H'
-    {   788,   3,  10,  17,   12,  -11 }, // 'I'
-    {   792,  13,  20,  17,    2,  -20 }, // 'J'
-    {   825,  13,  20,  17,    2,  -20 }, // 'K'
-    {   858,  13,  19,  17,    2,  -19 }, // 'L'
-    {   889,  13,  20,  17,    2,  -20 }, // 'M'
-    {   922,  13,  11,  17,    2,  -11 }, // 'N'
-    {   940,  13,  11,  17,    2,  -11 }, // 'O'
-    {   958,  13,  20,  17,    2,  -20 }, // 'P'
-    {   991,  13,  19,  17,    2,  -20 }, // 'Q'
-    {  1022,  12,  11,  17,    2,  -11 }, // 'R'
-    {  1039,  13,  19,  17,    2,  -19 }, // 'S'
-    {  1070,  13,  19,  17,    2,  -19 }, // 'T'
-    {  1101,  13,  11,  17,    2,  -11 }, // 'U'
-    {  1119,  13,  20,  17,    2,  -20 }, // 'V'
-    {  1152,  13,  20,  17,    2,  -20 }, // 'W'
-    {  1185,  13,  20,  17,    2,  -20 }, // 'X'
-    {  1218,  13,  20,  17,    2,  -20 }, // 'Y'
-    {  1251,  13,  20,  17,    2,  -20 }, // 'Z'
-    {  1284,   7,  14,   8,    1,  -14 }, // '['
-    {  1297,   7,  14,   8,    1,  -14 }, // '\'
-    {  1310,   7,  14,   8,    1,  -14 }, // ']'
-    {  1323,   7,  14,   8,    1,  -14 }, // '^'
-    {  1336,   7,  14,   8,    1,  -14 }, // '_'
-    {  1349,   7,  14,   8,    1,  -14 }, // '`'
-    {  1362,  13,  20,  17,    2,  -20 }, // 'a'
-    {  1395,  13,  19,  17,    2,  -19 }, // 'b'
-    {  1426,  13,  11,  17,    2,  -11 }, // 'c'
-    {  1444,  13,  20,  17,    2,  -20 }, // 'd'
-    {  1477,  13,  20,  17,    2,  -20 }, // 'e'
-    {  1510,  12,  20,  17,    2,  -20 }, // 'f'
-    {  1540,  13,  20,  17,    2,  -20 }, // 'g'
-    {  1573,  13,  19,  17,    2,  -19 }, // 'h'
-    {  1604,   3,  10,  17,   12,  -11 }, // 'i'
-    {  1608,  13,  20,  17,    2,  -20 }, // 'j'
-    {  1641,  13,  20,  17,    2,  -20 }, // 'k'
-    {  1674,  13,  19,  17,    2,  -19 }, // 'l'
-    {  1705,  13,  20,  17,    2,  -20 }, // 'm'
-    {  1738,  13,  11,  17,    2,  -11 }, // 'n'
-    {  1756,  13,  11,  17,    2,  -11 }, // 'o'
-    {  1774,  13,  20,  17,    2,  -20 }, // 'p'
-    {  1807,  13,  19,  17,    2,  -20 }, // 'q'
-    {  1838,  12,  11,  17,    2,  -11 }, // 'r'
-    {  1855,  13,  19,  17,    2,  -19 }, // 's'
-    {  1886,  13,  19,  17,    2,  -19 }, // 't'
-    {  1917,  13,  11,  17,    2,  -11 }, // 'u'
-    {  1935,  13,  20,  17,    2,  -20 }, // 'v'
-    {  1968,  13,  20,  17,    2,  -20 }, // 'w'
-    {  2001,  13,  20,  17,    2,  -20 }, // 'x'
-    {  2034,  13,  20,  17,    2,  -20 }, // 'y'
-    {  2067,  13,  20,  17,    2,  -20 }, // 'z'
-    {  2100,   7,  14,   8,    1,  -14 }, // '{'
-    {  2113,   7,  14,   8,    1,  -14 }, // '|'
-    {  2126,   7,  14,   8,    1,  -14 } // '}'
-};
-const GFXfont DSEG7_Modern_Bold_20 PROGMEM = {
-(uint8_t  *)DSEG7_Modern_Bold_20Bitmaps,(GFXglyph *)DSEG7_Modern_Bold_20Glyphs,0x20, 0x7E, 22};
-
-// Created by http://oleddisplay.squix.ch/ Consider a donation
-// In case of problems make sure that you are using the font file with the correct version!
-const uint8_t Slackey_Regular_16Bitmaps[] PROGMEM = {
-
-  // Bitmap Data:
-  0x00, // ' '
-  0xF7,0xB9,0xCE,0x73,0x88,0x80,0x39,0xC0, // '!'
-  0xDB,0x6D,0xB6,0xD8, // '"'
-  0x08,0xC0,0x88,0x18,0xC7,0xFE,0x19,0x81,0x18,0x7F,0xCF,0xF0,0x33,0x06,0x20, // '#'
-  0x0C,0x01,0x81,0xFE,0x7F,0xCE,0x01,0xF0,0x1F,0xF0,0x1E,0x81,0xDF,0xFB,0xFE,0x06,0x00,0xC0, // '$'
-  0xF9,0xC4,0x4C,0x32,0xC1,0xF6,0x00,0x20,0x03,0x00,0x13,0x81,0xB6,0x0D,0x10,0xC9,0x86,0x78, // '%'
-  0x3F,0x80,0xE7,0x07,0x1C,0x1E,0x00,0x3C,0x00,0x70,0x03,0xE0,0x1D,0xE4,0x61,0xF9,0xC3,0xCF,0x9F,0x1F,0xEE,0x7E,0x18, // '&'
-  0xDB,0x6C, // '''
-  0x21,0x10,0x8C,0x63,0x18,0xC2,0x18,0x43,0x08, // '('
-  0x41,0x02,0x0C,0x30,0xC1,0x86,0x30,0xC3,0x08,0x43,0x00, // ')'
-  0x06,0x26,0x3A,0x47,0xE1,0x83,0x30,0x98, // '*'
-  0x18,0x0C,0x26,0x8F,0xE0,0x80,0x40,0x20, // '+'
-  0xEE,0x6C, // ','
-  0xFE, // '-'
-  0xD8, // '.'
-  0x03,0x01,0x81,0x81,0x80,0xC0,0xC0,0x60,0x60,0x30,0x30,0x18,0x18,0x00, // '/'
-  0x3F,0x1F,0xF3,0x8F,0x71,0xEE,0x3D,0xC7,0xB8,0x77,0x1E,0xE3,0x9C,0x73,0x8E,0x3F,0x80, // '0'
-  0xF7,0xBC,0xE7,0x39,0xCE,0x73,0x9C,0xE0, // '1'
-  0xFF,0x3F,0xCC,0x73,0x1C,0x07,0x03,0x83,0xC3,0xC0,0xFF,0xBF,0xEF,0xFB,0xFE, // '2'
-  0x3F,0x3F,0xCF,0xF0,0xFC,0x1F,0x1F,0x07,0xF0,0x1E,0x03,0xBF,0xEF,0xFB,0xFC,0xE0,0x00, // '3'
-  0xCF,0x31,0xCC,0x73,0x1C,0xEF,0xBF,0xEF,0xF8,0x1C,0x07,0x01,0xC0,0x70,0x1C, // '4'
-  0xFF,0x9F,0xF3,0xFF,0x70,0x0E,0x01,0xFC,0x3F,0xE0,0x3C,0x13,0x9C,0x73,0xFE,0x7F,0x87,0xC0, // '5'
-  0x1F,0x0F,0xF3,0xFE,0x71,0xCE,0x3D,0xC0,0x3B,0xC7,0xFC,0xC3,0x98,0x73,0x8E,0x3F,0xC3,0xE0, // '6'
-  0x3F,0x7F,0xBD,0xDC,0xE0,0x60,0x70,0x30,0x38,0x38,0x1C,0x1C,0x1E,0x00, // '7'
-  0x7F,0x3F,0xEC,0x3B,0x0E,0xC3,0x9F,0xE7,0xF3,0x8E,0xC3,0xB0,0xEE,0x39,0xFE,0x30,0x00, // '8'
-  0xFF,0xBC,0xEE,0x1B,0x86,0xE1,0xB8,0x6F,0xF8,0xFE,0x03,0x9F,0xE7,0xF9,0xFC, // '9'
-  0xD8,0x0D,0x80, // ':'
-  0x4C,0xC0,0x0E,0xE6,0xC0, // ';'
-  0x08,0x21,0x8C,0xE1,0x83,0x06,0x08, // '<'
-  0xFE,0x00,0x7E, // '='
-  0x81,0x06,0x0C,0x18,0x62,0x30,0x80, // '>'
-  0xFF,0x9F,0xFB,0x8F,0x01,0xE0,0x1C,0x0F,0x87,0xF0,0xE0,0x1C,0x00,0x00,0x70,0x0E,0x00, // '?'
-  0x0F,0x80,0x71,0x83,0x01,0x1B,0xE4,0x4F,0xDB,0x03,0x6C,0xFD,0xB2,0x76,0x49,0xD1,0x99,0xC3,0x00,0x07,0xF0,0x07,0x00, // '@'
-  0x1F,0x0F,0xF1,0xFE,0x3F,0xC7,0x38,0xE7,0x1C,0xE3,0xFC,0xFF,0xDC,0x3B,0x87,0x00,0x60, // 'A'
-  0xFF,0x81,0xFF,0xC3,0x8F,0x8C,0x1E,0x30,0x78,0xE7,0xE3,0xFE,0x0F,0xFC,0x38,0x70,0xE3,0xC3,0xFF,0x0F,0xF8, // 'B'
-  0x1F,0xC3,0xFC,0x7F,0xC7,0xFC,0x70,0x06,0x00,0xE0,0x06,0x00,0x70,0x27,0xFE,0x3F,0xE0, // 'C'
-  0xFF,0xCF,0xFE,0xFF,0xEE,0x1E,0xE1,0xE6,0x1E,0x61,0xE7,0xFE,0x7F,0xE7,0xF8,0x70,0x00, // 'D'
-  0xFF,0xBF,0xEF,0xFB,0x80,0xFE,0x3F,0x8F,0xE3,0x80,0xE0,0x3F,0xCF,0xF3,0xFE, // 'E'
-  0xFF,0xBF,0xEF,0xFB,0xC0,0xF8,0x3F,0x8F,0x83,0xC0,0xF0,0x3C,0x0F,0x00, // 'F'
-  0x07,0x0F,0xFB,0xFF,0x7F,0xEE,0x01,0xC0,0x38,0x07,0x1E,0xE3,0xDC,0x7B,0xFF,0x3F,0xE0, // 'G'
-  0x03,0x9C,0x7B,0x8F,0x71,0xEE,0x3D,0xFF,0xBF,0xF7,0xFE,0xF1,0xDE,0x3B,0xC7,0x78,0xE0, // 'H'
-  0xFE,0xFE,0x7E,0x38,0x38,0x38,0x38,0x38,0x7E,0x7E,0x7E,0x40, // 'I'
-  0x0F,0x01,0xC0,0x70,0x1E,0x07,0x81,0xE0,0x78,0x1E,0x07,0xBF,0xCF,0xF3,0xF8, // 'J'
-  0x08,0x67,0x8F,0x3C,0xF1,0xEF,0x0F,0xF0,0x7F,0x83,0xFC,0x1F,0x70,0xF3,0xC3,0x8E,0x1C,0x38,0xE1,0xE0,0x04,0x00, // 'K'
-  0xF0,0x78,0x3C,0x1E,0x0F,0x07,0x03,0x81,0xC0,0xE0,0x7F,0x3F,0xDF,0xE0, // 'L'
-  0xF8,0x7B,0xE3,0xEF,0xCF,0xBF,0x7E,0xFD,0xFB,0xFE,0xEE,0xFB,0xBB,0xCE,0xE7,0x3B,0x9C,0xEE,0x63,0xB8,0x8E,0xE0,0x00, // 'M'
-  0xFE,0x77,0xF3,0xBF,0x9D,0xFE,0xEF,0x77,0x7B,0xBB,0xCF,0xDE,0x7E,0xF1,0xF3,0x8F,0x9C,0x3C,0xE1,0xE0,0x08,0x00, // 'N'
-  0x7F,0xF1,0xFF,0xEF,0xFF,0xBF,0xFE,0xF0,0x3B,0x80,0xEE,0x03,0xB8,0x0E,0xE0,0x39,0xFF,0xE7,0xFF,0x0F,0xF8, // 'O'
-  0x1F,0x87,0xFF,0x3E,0xF8,0xC3,0xE6,0x1F,0x30,0xF1,0xFF,0x8F,0xFC,0x70,0x03,0x80,0x1C,0x00,0xE0,0x00, // 'P'
-  0x07,0xE1,0xFF,0xEF,0xFF,0xBF,0xFE,0xE0,0x3B,0x80,0xEE,0x13,0xB9,0xFE,0xE7,0xFB,0xFF,0xE7,0xFF,0x07,0xF8,0x00,0xE0,0x01,0xC0, // 'Q'
-  0x0F,0x07,0xFC,0x70,0xEF,0x0E,0xF0,0xEF,0x1E,0xFF,0xCF,0xF8,0xF3,0x8F,0x3C,0xF3,0xC6,0x1E, // 'R'
-  0x7F,0xE7,0xFF,0x3F,0xF9,0xFF,0xCE,0x00,0x7E,0x01,0xFF,0x80,0x1C,0x00,0xF7,0xFF,0xBF,0xF9,0xFF,0x80, // 'S'
-  0xFF,0xBF,0xEF,0xFB,0xFE,0xFC,0x07,0x01,0xC0,0x70,0x1C,0x07,0x01,0xC0,0x70, // 'T'
-  0x00,0xE3,0x87,0x3C,0x39,0xE1,0xEF,0x0F,0x78,0x7B,0xC3,0xDE,0x1E,0xFF,0xF7,0xFF,0x9F,0xF8,0x7F,0x80, // 'U'
-  0xE0,0xEE,0x0E,0x60,0xC7,0x1C,0x71,0xC3,0x3C,0x3B,0x83,0xB8,0x3F,0x81,0xF8,0x1F,0x81,0xF0, // 'V'
-  0xF9,0x0A,0xF9,0x8C,0x79,0x8C,0x7B,0x8C,0x7B,0xDC,0x7B,0xDC,0x3F,0xFC,0x3F,0xF8,0x3F,0x78,0x3E,0x78,0x1E,0x38,0x1C,0x38, // 'W'
-  0xC0,0xFB,0xE3,0xC7,0x9E,0x0F,0xF0,0x3F,0x80,0x7C,0x00,0xF0,0x07,0xE0,0x3F,0x80,0xEF,0x07,0x1E,0x3C,0x3C, // 'X'
-  0xE1,0xCE,0x1C,0xE1,0xCE,0x1C,0xF1,0xEF,0xFE,0x7F,0xE3,0x1E,0x01,0xE3,0xFE,0xFF,0xCF,0xF8, // 'Y'
-  0xFF,0xDF,0xF8,0x0F,0x03,0xE0,0xF8,0x3C,0x0F,0x03,0x80,0xFF,0xDF,0xFB,0xFF,0x00, // 'Z'
-  0xE7,0xB1,0x8C,0x63,0x18,0xC6,0x31,0x8E,0x70, // '['
-  0xC0,0x60,0x18,0x0C,0x03,0x00,0xC0,0x60,0x18,0x0C,0x03,0x01,0x80,0x60, // '\'
-  0xE7,0x8C,0x63,0x18,0xC6,0x31,0x8C,0x6F,0x78, // ']'
-  0x08,0x0C,0x07,0x06,0x86,0x63,0x13,0x04, // '^'
-  0xFF,0xBF,0xE0, // '_'
-  0xCE,0x20, // '`'
-  0x7F,0xC3,0xFF,0x20,0x3C,0x01,0xE7,0xFF,0x38,0x79,0xC3,0xCF,0xFE,0x1C,0x00, // 'a'
-  0x80,0x06,0x00,0x30,0x01,0x80,0x0D,0xFE,0x7F,0xF3,0x83,0xDE,0x0E,0xF0,0xF7,0xFF,0xBF,0xF9,0xC0,0x00, // 'b'
-  0x3F,0xE7,0xFE,0xFF,0xEF,0x80,0xE0,0x0F,0x0C,0x7F,0xC7,0xFC, // 'c'
-  0x00,0xE0,0x07,0x80,0x3C,0x01,0xE1,0xFF,0x3F,0xFB,0xFF,0x9E,0x0C,0xF0,0x67,0xFF,0x1F,0xF8,0x7F,0xC0, // 'd'
-  0x3F,0xC7,0x0E,0x70,0x6F,0xFE,0xF0,0x0E,0x00,0x7F,0xC7,0xFC,0x06,0x00, // 'e'
-  0x1E,0x3E,0x3E,0x38,0x30,0xFC,0xFC,0x78,0x78,0x78,0x78,0x78, // 'f'
-  0x00,0xE7,0xFE,0x7F,0xE7,0x0E,0x70,0xEF,0x0E,0xF1,0xE7,0xFE,0x1F,0xE0,0x0E,0x3F,0xE3,0xFE,0x3F,0x80, // 'g'
-  0xB0,0x07,0x00,0x70,0x07,0x00,0x7F,0xC7,0xFE,0x79,0xE7,0x1E,0x71,0xE7,0x1E,0x61,0xE6,0x1E, // 'h'
-  0x67,0x18,0x07,0x39,0xCE,0x73,0x98, // 'i'
-  0x18,0x78,0x60,0x00,0x03,0x87,0x0E,0x1C,0x38,0x70,0xE1,0xDF,0x9F,0x3C, // 'j'
-  0xC0,0x18,0x03,0x00,0x60,0xEC,0x79,0x9C,0x3F,0x07,0xF0,0xEE,0x1C,0xFB,0x9F,0x61,0xE0, // 'k'
-  0xEE,0xEE,0xEE,0xEE,0xEC,0xCC, // 'l'
-  0xEE,0xFC,0xFF,0xFC,0xFF,0x8C,0xE3,0x0E,0xE3,0x0E,0xE3,0x0E,0xE3,0x0E,0xE3,0x0C, // 'm'
-  0x07,0x1D,0xF3,0xFF,0x31,0xE6,0x1C,0xC3,0x98,0x73,0x1E, // 'n'
-  0xFF,0xEF,0xFE,0xE0,0xEE,0x0E,0xE0,0xEE,0x0E,0xFF,0xE7,0xFC, // 'o'
-  0x20,0x0F,0xF8,0xFF,0xCF,0xFE,0xE1,0xEE,0x0E,0xE0,0xEF,0xFE,0xFF,0xCE,0x00,0xE0,0x0E,0x00, // 'p'
-  0x00,0xC1,0xFF,0x9F,0x7C,0xE1,0xEF,0x0F,0x78,0x79,0xFF,0xCF,0xFE,0x1F,0xF0,0x07,0x80,0x3C,0x01,0xE0, // 'q'
-  0xF3,0x8F,0xF9,0xFF,0x38,0xE7,0x00,0xE0,0x1C,0x03,0x80,0x70,0x00, // 'r'
-  0x3F,0x9F,0xE6,0x03,0xFC,0x7F,0x80,0x67,0xF9,0xFE,0x7F,0x80, // 's'
-  0x40,0x1C,0x0E,0x0F,0x87,0xC7,0xC1,0xE0,0xF0,0x78,0x1E,0x8F,0xC3,0xE0, // 't'
-  0x80,0x1C,0x3B,0x87,0x70,0xEE,0x1D,0xC7,0xBF,0xF7,0xFE,0x7E,0xC0, // 'u'
-  0xE1,0xDE,0x79,0xCE,0x3B,0xC7,0x70,0x6C,0x0F,0x80,0xE0, // 'v'
-  0x00,0x0D,0xE6,0x3B,0xCE,0x63,0xBC,0xC7,0x7F,0x8F,0xDF,0x1F,0xBE,0x3E,0x78,0x78,0x70, // 'w'
-  0xF9,0xF1,0xDE,0x07,0xE0,0x1E,0x00,0xF0,0x0F,0xC0,0xEE,0x0E,0x38,0x80,0xE0, // 'x'
-  0xE1,0xCE,0x1C,0xE1,0xCE,0x1C,0xE1,0xCE,0x1C,0xFF,0xCF,0xFE,0x7F,0xC0,0x0C,0x0F,0xC3,0xFC,0x3F,0xC0, // 'y'
-  0x1F,0xBF,0xEF,0xF8,0x1E,0x0F,0x0F,0x87,0x81,0xFE,0x7F,0x80, // 'z'
-  0x18,0xE2,0x08,0x21,0x8E,0x38,0x60,0x82,0x18,0x70,0xE0, // '{'
-  0xDA,0x49,0x24,0x93,0x60, // '|'
-  0xE1,0xE0,0xC0,0x83,0x06,0x07,0x0E,0x38,0x60,0xC1,0x83,0x1C,0x00 // '}'
-};
-const GFXglyph Slackey_Regular_16Glyphs[] PROGMEM = {
-// bitmapOffset, width, height, xAdvance, xOffset, yOffset
-    {     0,   1,   1,   7,    0,    0 }, // ' '
-    {     1,   5,  12,   6,    1,  -12 }, // '!'
-    {     9,   6,   5,   8,    1,  -12 }, // '"'
-    {    13,  12,  10,  12,    0,  -11 }, // '#'
-    {    28,  11,  13,  12,    1,  -12 }, // '$'
-    {    46,  13,  11,  13,    0,  -11 }, // '%'
-    {    64,  14,  13,  14,    0,  -12 }, // '&'
-    {    87,   3,   5,   4,    1,  -12 }, // '''
-    {    89,   5,  14,   6,    1,  -13 }, // '('
-    {    98,   6,  14,   7,    0,  -13 }, // ')'
-    {   109,   9,   7,   9,    0,  -12 }, // '*'
-    {   117,   9,   7,   9,    0,   -9 }, // '+'
-    {   125,   4,   4,   5,    1,   -2 }, // ','
-    {   127,   8,   1,   8,    0,   -6 }, // '-'
-    {   128,   3,   2,   5,    1,   -2 }, // '.'
-    {   129,   9,  12,   9,    0,  -12 }, // '/'
-    {   143,  11,  12,  12,    1,  -12 }, // '0'
-    {   160,   5,  12,   8,    1,  -12 }, // '1'
-    {   168,  10,  12,  11,    1,  -12 }, // '2'
-    {   183,  10,  13,  12,    1,  -12 }, // '3'
-    {   200,  10,  12,  12,    1,  -12 }, // '4'
-    {   215,  11,  13,  12,    1,  -12 }, // '5'
-    {   233,  11,  13,  12,    1,  -12 }, // '6'
-    {   251,   9,  12,  10,    1,  -12 }, // '7'
-    {   265,  10,  13,  12,    1,  -12 }, // '8'
-    {   282,  10,  12,  12,    1,  -12 }, // '9'
-    {   297,   3,   6,   5,    1,   -6 }, // ':'
-    {   300,   4,   9,   6,    1,   -7 }, // ';'
-    {   305,   6,   9,   7,    0,   -9 }, // '<'
-    {   312,   8,   3,   8,    0,   -7 }, // '='
-    {   315,   6,   9,   7,    0,   -9 }, // '>'
-    {   322,  11,  12,  11,    0,  -12 }, // '?'
-    {   339,  14,  13,  14,    0,  -12 }, // '@'
-    {   362,  11,  12,  13,    1,  -12 }, // 'A'
-    {   379,  14,  12,  15,    0,  -12 }, // 'B'
-    {   400,  12,  11,  13,    0,  -12 }, // 'C'
-    {   417,  12,  11,  14,    1,  -11 }, // 'D'
-    {   434,  10,  12,  11,    1,  -12 }, // 'E'
-    {   449,  10,  11,  12,    1,  -11 }, // 'F'
-    {   463,  11,  12,  13,    1,  -12 }, // 'G'
-    {   480,  11,  12,  13,    1,  -12 }, // 'H'
-    {   497,   8,  12,   9,    0,  -11 }, // 'I'
-    {   509,  10,  12,  11,    0,  -12 }, // 'J'
-    {   524,  13,  13,  13,    1,  -12 }, // 'K'
-    {   546,   9,  12,  10,    1,  -12 }, // 'L'
-    {   560,  14,  13,  17,    1,  -12 }, // 'M'
-    {   583,  13,  13,  16,    1,  -12 }, // 'N'
-    {   605,  14,  12,  16,    1,  -12 }, // 'O'
-    {   626,  13,  12,  14,    1,  -12 }, // 'P'
-    {   646,  14,  14,  16,    1,  -12 }, // 'Q'
-    {   671,  12,  12,  14,    1,  -12 }, // 'R'
-    {   689,  13,  12,  14,    1,  -12 }, // 'S'
-    {   709,  10,  12,  12,    1,  -12 }, // 'T'
-    {   724,  13,  12,  15,    1,  -12 }, // 'U'
-    {   744,  12,  12,  12,    0,  -12 }, // 'V'
-    {   762,  16,  12,  16,    0,  -12 }, // 'W'
-    {   786,  14,  12,  13,    0,  -12 }, // 'X'
-    {   807,  12,  12,  14,    1,  -12 }, // 'Y'
-    {   825,  11,  11,  13,    1,  -11 }, // 'Z'
-    {   841,   5,  14,   6,    1,  -13 }, // '['
-    {   850,   9,  12,   9,    0,  -12 }, // '\'
-    {   864,   5,  14,   6,    0,  -13 }, // ']'
-    {   873,   9,   7,   9,    0,  -12 }, // '^'
-    {   881,  10,   2,  10,    0,   -2 }, // '_'
-    {   884,   4,   3,  16,    6,  -13 }, // '`'
-    {   886,  13,   9,  14,    0,  -10 }, // 'a'
-    {   901,  13,  12,  14,    1,  -12 }, // 'b'
-    {   921,  12,   8,  12,    0,  -10 }, // 'c'
-    {   933,  13,  12,  13,    0,  -12 }, // 'd'
-    {   953,  12,   9,  13,    0,  -10 }, // 'e'
-    {   967,   8,  12,   8,    0,  -12 }, // 'f'
-    {   979,  12,  13,  13,    0,  -11 }, // 'g'
-    {   999,  12,  12,  13,    0,  -12 }, // 'h'
-    {  1017,   5,  11,   6,    0,  -12 }, // 'i'
-    {  1024,   7,  16,   6,   -2,  -12 }, // 'j'
-    {  1038,  11,  12,  12,    1,  -12 }, // 'k'
-    {  1055,   4,  12,   6,    1,  -12 }, // 'l'
-    {  1061,  16,   8,  18,    1,   -9 }, // 'm'
-    {  1077,  11,   8,  12,    0,  -11 }, // 'n'
-    {  1088,  12,   8,  14,    1,  -10 }, // 'o'
-    {  1100,  12,  12,  14,    1,  -11 }, // 'p'
-    {  1118,  13,  12,  14,    0,  -11 }, // 'q'
-    {  1138,  11,   9,  11,    0,  -10 }, // 'r'
-    {  1151,  10,   9,  11,    0,  -11 }, // 's'
-    {  1163,   9,  12,   9,    0,  -12 }, // 't'
-    {  1177,  11,   9,  13,    1,  -10 }, // 'u'
-    {  1190,  11,   8,  11,    0,   -9 }, // 'v'
-    {  1201,  15,   9,  15,    0,  -11 }, // 'w'
-    {  1218,  13,   9,  11,   -1,  -10 }, // 'x'
-    {  1233,  12,  13,  13,    1,  -11 }, // 'y'
-    {  1253,  10,   9,  11,    0,  -11 }, // 'z'
-    {  1265,   6,  14,   7,    1,  -13 }, // '{'
-    {  1276,   3,  12,   5,    1,  -12 }, // '|'
-    {  1281,   7,  14,   7,    0,  -13 } // '}'
-};
-const GFXfont Slackey_Regular_16 PROGMEM = {
-(uint8_t  *)Slackey_Regular_16Bitmaps,(GFXglyph *)Slackey_Regular_16Glyphs,0x20, 0x7E, 23};
-
-// Created by http://oleddisplay.squix.ch/ Consider a donation
-// In case of problems make sure that you are using the font file with the correct version!
-const uint8_t DSEG7_Classic_Regular_32Bitmaps[] PROGMEM = {
-
-  // Bitmap Data:
-  0x00, // ' '
-  0x00, // '!'
-  0xFF,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x2F,0xF0, // '"'
-  0xFF,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x2F,0xF0, // '#'
-  0xFF,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x2F,0xF0, // '$'
-  0xFF,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x2F,0xF0, // '%'
-  0xFF,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x2F,0xF0, // '&'
-  0xFF,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x2F,0xF0, // '''
-  0xFF,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x2F,0xF0, // '('
-  0xFF,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x2F,0xF0, // ')'
-  0xFF,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x2F,0xF0, // '*'
-  0xFF,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x2F,0xF0, // '+'
-  0xFF,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x2F,0xF0, // ','
-  0x00,0x00,0x7F,0xFF,0xBF,0xFF,0xC0, // '-'
-  0x67,0xBC,0xC0, // '.'
-  0xFF,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x2F,0xF0, // '/'
-  0x3F,0xFF,0xC1,0xFF,0xFE,0x37,0xFF,0xED,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x80,0x01,0xDC,0x00,0x0E,0xE0,0x00,0x77,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x00,0x00,0xD0,0x00,0x02,0x80,0x00,0x16,0x00,0x01,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x80,0x01,0xDC,0x00,0x0E,0xE0,0x00,0x77,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x6F,0xFF,0xD8,0xFF,0xFF,0x07,0xFF,0xF8, // '0'
-  0x06,0xEE,0xEE,0xEE,0xEE,0xEE,0xE6,0x22,0x6E,0xEE,0xEE,0xEE,0xEE,0xEE,0x60, // '1'
-  0x3F,0xFF,0xC1,0xFF,0xFE,0x07,0xFF,0xEC,0x00,0x00,0xE0,0x00,0x07,0x00,0x00,0x38,0x00,0x01,0xC0,0x00,0x0E,0x00,0x00,0x70,0x00,0x03,0x80,0x00,0x1C,0x00,0x00,0xE0,0x00,0x07,0x00,0x00,0x38,0x00,0x00,0xC7,0xFF,0xFA,0xBF,0xFF,0xC6,0x00,0x00,0x38,0x00,0x01,0xC0,0x00,0x0E,0x00,0x00,0x70,0x00,0x03,0x80,0x00,0x1C,0x00,0x00,0xE0,0x00,0x07,0x00,0x00,0x38,0x00,0x01,0xC0,0x00,0x0E,0x00,0x00,0x6F,0xFF,0xC0,0xFF,0xFF,0x07,0xFF,0xF8, // '2'
-  0xFF,0xFF,0x1F,0xFF,0xE1,0xFF,0xFB,0x00,0x00,0xE0,0x00,0x1C,0x00,0x03,0x80,0x00,0x70,0x00,0x0E,0x00,0x01,0xC0,0x00,0x38,0x00,0x07,0x00,0x00,0xE0,0x00,0x1C,0x00,0x03,0x80,0x00,0x37,0xFF,0xFA,0xFF,0xFF,0x40,0x00,0x18,0x00,0x07,0x00,0x00,0xE0,0x00,0x1C,0x00,0x03,0x80,0x00,0x70,0x00,0x0E,0x00,0x01,0xC0,0x00,0x38,0x00,0x07,0x00,0x00,0xE0,0x00,0x1C,0xFF,0xFD,0xBF,0xFF,0xC7,0xFF,0xF8, // '3'
-  0x00,0x00,0x06,0x00,0x01,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x80,0x01,0xDC,0x00,0x0E,0xE0,0x00,0x77,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x60,0x00,0x1A,0xFF,0xFF,0x47,0xFF,0xFA,0x00,0x00,0x30,0x00,0x03,0x80,0x00,0x1C,0x00,0x00,0xE0,0x00,0x07,0x00,0x00,0x38,0x00,0x01,0xC0,0x00,0x0E,0x00,0x00,0x70,0x00,0x03,0x80,0x00,0x1C,0x00,0x00,0xE0,0x00,0x03,0x00,0x00,0x00, // '4'
-  0x3F,0xFF,0xC1,0xFF,0xFE,0x37,0xFF,0xE1,0xC0,0x00,0x0E,0x00,0x00,0x70,0x00,0x03,0x80,0x00,0x1C,0x00,0x00,0xE0,0x00,0x07,0x00,0x00,0x38,0x00,0x01,0xC0,0x00,0x0E,0x00,0x00,0x70,0x00,0x03,0x00,0x00,0x17,0xFF,0xF8,0x3F,0xFF,0xD0,0x00,0x01,0x80,0x00,0x1C,0x00,0x00,0xE0,0x00,0x07,0x00,0x00,0x38,0x00,0x01,0xC0,0x00,0x0E,0x00,0x00,0x70,0x00,0x03,0x80,0x00,0x1C,0x00,0x00,0xE0,0x00,0x07,0x0F,0xFF,0xD8,0xFF,0xFF,0x07,0xFF,0xF8, // '5'
-  0x3F,0xFF,0xC1,0xFF,0xFE,0x37,0xFF,0xE1,0xC0,0x00,0x0E,0x00,0x00,0x70,0x00,0x03,0x80,0x00,0x1C,0x00,0x00,0xE0,0x00,0x07,0x00,0x00,0x38,0x00,0x01,0xC0,0x00,0x0E,0x00,0x00,0x70,0x00,0x03,0x00,0x00,0x17,0xFF,0xF8,0xBF,0xFF,0xD6,0x00,0x01,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x80,0x01,0xDC,0x00,0x0E,0xE0,0x00,0x77,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x6F,0xFF,0xD8,0xFF,0xFF,0x07,0xFF,0xF8, // '6'
-  0x3F,0xFF,0xC1,0xFF,0xFE,0x37,0xFF,0xED,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x80,0x01,0xDC,0x00,0x0E,0xE0,0x00,0x77,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x00,0x00,0xD0,0x00,0x02,0x00,0x00,0x10,0x00,0x01,0x80,0x00,0x1C,0x00,0x00,0xE0,0x00,0x07,0x00,0x00,0x38,0x00,0x01,0xC0,0x00,0x0E,0x00,0x00,0x70,0x00,0x03,0x80,0x00,0x1C,0x00,0x00,0xE0,0x00,0x07,0x00,0x00,0x18,0x00,0x00,0x00, // '7'
-  0x3F,0xFF,0xC1,0xFF,0xFE,0x37,0xFF,0xED,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x80,0x01,0xDC,0x00,0x0E,0xE0,0x00,0x77,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x00,0x00,0xD7,0xFF,0xFA,0xBF,0xFF,0xD6,0x00,0x01,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x80,0x01,0xDC,0x00,0x0E,0xE0,0x00,0x77,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x6F,0xFF,0xD8,0xFF,0xFF,0x07,0xFF,0xF8, // '8'
-  0x3F,0xFF,0xC1,0xFF,0xFE,0x37,0xFF,0xED,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x80,0x01,0xDC,0x00,0x0E,0xE0,0x00,0x77,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x00,0x00,0xD7,0xFF,0xFA,0x3F,0xFF,0xD0,0x00,0x01,0x80,0x00,0x1C,0x00,0x00,0xE0,0x00,0x07,0x00,0x00,0x38,0x00,0x01,0xC0,0x00,0x0E,0x00,0x00,0x70,0x00,0x03,0x80,0x00,0x1C,0x00,0x00,0xE0,0x00,0x07,0x0F,0xFF,0xD8,0xFF,0xFF,0x07,0xFF,0xF8, // '9'
-  0x77,0xBC,0xC0,0x00,0x00,0x00,0x00,0x00,0x33,0xDE,0x70, // ':'
-  0xFF,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x2F,0xF0, // ';'
-  0xFF,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x2F,0xF0, // '<'
-  0xFF,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x2F,0xF0, // '='
-  0xFF,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x2F,0xF0, // '>'
-  0xFF,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x2F,0xF0, // '?'
-  0xFF,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x2F,0xF0, // '@'
-  0x3F,0xFF,0xC1,0xFF,0xFE,0x37,0xFF,0xED,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x80,0x01,0xDC,0x00,0x0E,0xE0,0x00,0x77,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x00,0x00,0xD7,0xFF,0xFA,0xBF,0xFF,0xD6,0x00,0x01,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x80,0x01,0xDC,0x00,0x0E,0xE0,0x00,0x77,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x60,0x00,0x18,0x00,0x00,0x00, // 'A'
-  0x00,0x00,0x06,0x00,0x00,0x38,0x00,0x01,0xC0,0x00,0x0E,0x00,0x00,0x70,0x00,0x03,0x80,0x00,0x1C,0x00,0x00,0xE0,0x00,0x07,0x00,0x00,0x38,0x00,0x01,0xC0,0x00,0x0E,0x00,0x00,0x60,0x00,0x02,0xFF,0xFF,0x17,0xFF,0xFA,0xC0,0x00,0x37,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x80,0x01,0xDC,0x00,0x0E,0xE0,0x00,0x77,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xED,0xFF,0xFB,0x1F,0xFF,0xE0,0xFF,0xFF,0x00, // 'B'
-  0x00,0x00,0x03,0xFF,0xFC,0xBF,0xFF,0xCC,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0D,0xFF,0xF8,0x3F,0xFF,0xC3,0xFF,0xFC, // 'C'
-  0x00,0x00,0x00,0x00,0x01,0x80,0x00,0x1C,0x00,0x00,0xE0,0x00,0x07,0x00,0x00,0x38,0x00,0x01,0xC0,0x00,0x0E,0x00,0x00,0x70,0x00,0x03,0x80,0x00,0x1C,0x00,0x00,0xE0,0x00,0x07,0x00,0x00,0x18,0xFF,0xFF,0x57,0xFF,0xFA,0xC0,0x00,0x37,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x80,0x01,0xDC,0x00,0x0E,0xE0,0x00,0x77,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xED,0xFF,0xFB,0x1F,0xFF,0xE0,0xFF,0xFF,0x00, // 'D'
-  0x3F,0xFF,0xC3,0xFF,0xFC,0xDF,0xFF,0x8E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xC0,0x00,0x0B,0xFF,0xFC,0xBF,0xFF,0xCC,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0D,0xFF,0xF8,0x3F,0xFF,0xC3,0xFF,0xFC, // 'E'
-  0x3F,0xFF,0xC3,0xFF,0xFC,0xDF,0xFF,0x8E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xC0,0x00,0x0B,0xFF,0xFC,0xBF,0xFF,0xCC,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0C,0x00,0x00,0x00,0x00,0x00, // 'F'
-  0x3F,0xFF,0xC1,0xFF,0xFE,0x37,0xFF,0xE1,0xC0,0x00,0x0E,0x00,0x00,0x70,0x00,0x03,0x80,0x00,0x1C,0x00,0x00,0xE0,0x00,0x07,0x00,0x00,0x38,0x00,0x01,0xC0,0x00,0x0E,0x00,0x00,0x70,0x00,0x03,0x00,0x00,0x10,0x00,0x00,0x80,0x00,0x16,0x00,0x01,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x80,0x01,0xDC,0x00,0x0E,0xE0,0x00,0x77,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x6F,0xFF,0xD8,0xFF,0xFF,0x07,0xFF,0xF8, // 'G'
-  0x00,0x00,0x06,0x00,0x00,0x38,0x00,0x01,0xC0,0x00,0x0E,0x00,0x00,0x70,0x00,0x03,0x80,0x00,0x1C,0x00,0x00,0xE0,0x00,0x07,0x00,0x00,0x38,0x00,0x01,0xC0,0x00,0x0E,0x00,0x00,0x60,0x00,0x02,0xFF,0xFF,0x17,0xFF,0xFA,0xC0,0x00,0x37,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x80,0x01,0xDC,0x00,0x0E,0xE0,0x00,0x77,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xEC,0x00,0x03,0x00,0x00,0x00, // 'H'
-  0x26,0xEE,0xEE,0xEE,0xEE,0xEE,0xE6,0x00, // 'I'
-  0x00,0x00,0x00,0x00,0x01,0x80,0x00,0x1C,0x00,0x00,0xE0,0x00,0x07,0x00,0x00,0x38,0x00,0x01,0xC0,0x00,0x0E,0x00,0x00,0x70,0x00,0x03,0x80,0x00,0x1C,0x00,0x00,0xE0,0x00,0x07,0x00,0x00,0x18,0x00,0x00,0x50,0x00,0x02,0xC0,0x00,0x37,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x80,0x01,0xDC,0x00,0x0E,0xE0,0x00,0x77,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xED,0xFF,0xFB,0x1F,0xFF,0xE0,0xFF,0xFF,0x00, // 'J'
-  0x3F,0xFF,0xC1,0xFF,0xFE,0x37,0xFF,0xE1,0xC0,0x00,0x0E,0x00,0x00,0x70,0x00,0x03,0x80,0x00,0x1C,0x00,0x00,0xE0,0x00,0x07,0x00,0x00,0x38,0x00,0x01,0xC0,0x00,0x0E,0x00,0x00,0x70,0x00,0x03,0x00,0x00,0x17,0xFF,0xF8,0xBF,0xFF,0xD6,0x00,0x01,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x80,0x01,0xDC,0x00,0x0E,0xE0,0x00,0x77,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x60,0x00,0x18,0x00,0x00,0x00, // 'K'
-  0x00,0x00,0x0C,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0C,0x00,0x00,0x80,0x00,0x08,0x00,0x00,0xC0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xDF,0xFF,0x83,0xFF,0xFC,0x3F,0xFF,0xC0, // 'L'
-  0x3F,0xFF,0xC1,0xFF,0xFE,0x37,0xFF,0xED,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x80,0x01,0xDC,0x00,0x0E,0xE0,0x00,0x77,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x00,0x00,0xD0,0x00,0x02,0x80,0x00,0x16,0x00,0x01,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x80,0x01,0xDC,0x00,0x0E,0xE0,0x00,0x77,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x60,0x00,0x18,0x00,0x00,0x00, // 'M'
-  0x00,0x00,0x01,0xFF,0xFE,0x2F,0xFF,0xF5,0x80,0x00,0x6E,0x00,0x07,0x70,0x00,0x3B,0x80,0x01,0xDC,0x00,0x0E,0xE0,0x00,0x77,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x80,0x01,0xD8,0x00,0x06,0x00,0x00,0x00, // 'N'
-  0x00,0x00,0x01,0xFF,0xFE,0x2F,0xFF,0xF5,0x80,0x00,0x6E,0x00,0x07,0x70,0x00,0x3B,0x80,0x01,0xDC,0x00,0x0E,0xE0,0x00,0x77,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x80,0x01,0xDB,0xFF,0xF6,0x3F,0xFF,0xC1,0xFF,0xFE,0x00, // 'O'
-  0x3F,0xFF,0xC1,0xFF,0xFE,0x37,0xFF,0xED,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x80,0x01,0xDC,0x00,0x0E,0xE0,0x00,0x77,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x00,0x00,0xD7,0xFF,0xFA,0xBF,0xFF,0xC6,0x00,0x00,0x38,0x00,0x01,0xC0,0x00,0x0E,0x00,0x00,0x70,0x00,0x03,0x80,0x00,0x1C,0x00,0x00,0xE0,0x00,0x07,0x00,0x00,0x38,0x00,0x01,0xC0,0x00,0x0E,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x00, // 'P'
-  0x3F,0xFF,0xC1,0xFF,0xFE,0x37,0xFF,0xED,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x80,0x01,0xDC,0x00,0x0E,0xE0,0x00,0x77,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x00,0x00,0xD7,0xFF,0xFA,0x3F,0xFF,0xD0,0x00,0x01,0x80,0x00,0x1C,0x00,0x00,0xE0,0x00,0x07,0x00,0x00,0x38,0x00,0x01,0xC0,0x00,0x0E,0x00,0x00,0x70,0x00,0x03,0x80,0x00,0x1C,0x00,0x00,0xE0,0x00,0x07,0x00,0x00,0x18,0x00,0x00,0x00, // 'Q'
-  0x00,0x00,0x07,0xFF,0xFA,0xFF,0xFF,0x60,0x00,0x0E,0x00,0x01,0xC0,0x00,0x38,0x00,0x07,0x00,0x00,0xE0,0x00,0x1C,0x00,0x03,0x80,0x00,0x70,0x00,0x0E,0x00,0x01,0xC0,0x00,0x38,0x00,0x06,0x00,0x00,0x00,0x00,0x00, // 'R'
-  0x00,0x00,0x06,0x00,0x00,0x38,0x00,0x01,0xC0,0x00,0x0E,0x00,0x00,0x70,0x00,0x03,0x80,0x00,0x1C,0x00,0x00,0xE0,0x00,0x07,0x00,0x00,0x38,0x00,0x01,0xC0,0x00,0x0E,0x00,0x00,0x60,0x00,0x02,0xFF,0xFF,0x07,0xFF,0xFA,0x00,0x00,0x30,0x00,0x03,0x80,0x00,0x1C,0x00,0x00,0xE0,0x00,0x07,0x00,0x00,0x38,0x00,0x01,0xC0,0x00,0x0E,0x00,0x00,0x70,0x00,0x03,0x80,0x00,0x1C,0x00,0x00,0xE1,0xFF,0xFB,0x1F,0xFF,0xE0,0xFF,0xFF,0x00, // 'S'
-  0x00,0x00,0x0C,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0C,0x00,0x00,0xBF,0xFF,0xCB,0xFF,0xFC,0xC0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xDF,0xFF,0x83,0xFF,0xFC,0x3F,0xFF,0xC0, // 'T'
-  0x80,0x00,0x16,0x00,0x01,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x80,0x01,0xDC,0x00,0x0E,0xE0,0x00,0x77,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x6F,0xFF,0xD8,0xFF,0xFF,0x07,0xFF,0xF8, // 'U'
-  0x00,0x00,0x06,0x00,0x01,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x80,0x01,0xDC,0x00,0x0E,0xE0,0x00,0x77,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x60,0x00,0x1A,0x00,0x00,0x50,0x00,0x02,0xC0,0x00,0x37,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x80,0x01,0xDC,0x00,0x0E,0xE0,0x00,0x77,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xED,0xFF,0xFB,0x1F,0xFF,0xE0,0xFF,0xFF,0x00, // 'V'
-  0x00,0x00,0x06,0x00,0x01,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x80,0x01,0xDC,0x00,0x0E,0xE0,0x00,0x77,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x60,0x00,0x1A,0xFF,0xFF,0x57,0xFF,0xFA,0xC0,0x00,0x37,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x80,0x01,0xDC,0x00,0x0E,0xE0,0x00,0x77,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xED,0xFF,0xFB,0x1F,0xFF,0xE0,0xFF,0xFF,0x00, // 'W'
-  0x00,0x00,0x06,0x00,0x01,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x80,0x01,0xDC,0x00,0x0E,0xE0,0x00,0x77,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x60,0x00,0x1A,0xFF,0xFF,0x57,0xFF,0xFA,0xC0,0x00,0x37,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x80,0x01,0xDC,0x00,0x0E,0xE0,0x00,0x77,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xEC,0x00,0x03,0x00,0x00,0x00, // 'X'
-  0x00,0x00,0x06,0x00,0x01,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x80,0x01,0xDC,0x00,0x0E,0xE0,0x00,0x77,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x60,0x00,0x1A,0xFF,0xFF,0x47,0xFF,0xFA,0x00,0x00,0x30,0x00,0x03,0x80,0x00,0x1C,0x00,0x00,0xE0,0x00,0x07,0x00,0x00,0x38,0x00,0x01,0xC0,0x00,0x0E,0x00,0x00,0x70,0x00,0x03,0x80,0x00,0x1C,0x00,0x00,0xE1,0xFF,0xFB,0x1F,0xFF,0xE0,0xFF,0xFF,0x00, // 'Y'
-  0x3F,0xFF,0xC1,0xFF,0xFE,0x07,0xFF,0xEC,0x00,0x00,0xE0,0x00,0x07,0x00,0x00,0x38,0x00,0x01,0xC0,0x00,0x0E,0x00,0x00,0x70,0x00,0x03,0x80,0x00,0x1C,0x00,0x00,0xE0,0x00,0x07,0x00,0x00,0x38,0x00,0x00,0xC0,0x00,0x02,0x80,0x00,0x06,0x00,0x00,0x38,0x00,0x01,0xC0,0x00,0x0E,0x00,0x00,0x70,0x00,0x03,0x80,0x00,0x1C,0x00,0x00,0xE0,0x00,0x07,0x00,0x00,0x38,0x00,0x01,0xC0,0x00,0x0E,0x00,0x00,0x6F,0xFF,0xC0,0xFF,0xFF,0x07,0xFF,0xF8, // 'Z'
-  0xFF,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x2F,0xF0, // '['
-  0xFF,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x2F,0xF0, // '\'
-  0xFF,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x2F,0xF0, // ']'
-  0xFF,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x2F,0xF0, // '^'
-  0xFF,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x2F,0xF0, // '_'
-  0xFF,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x2F,0xF0, // '`'
-  0x3F,0xFF,0xC1,0xFF,0xFE,0x37,0xFF,0xED,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x80,0x01,0xDC,0x00,0x0E,0xE0,0x00,0x77,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x00,0x00,0xD7,0xFF,0xFA,0xBF,0xFF,0xD6,0x00,0x01,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x80,0x01,0xDC,0x00,0x0E,0xE0,0x00,0x77,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x60,0x00,0x18,0x00,0x00,0x00, // 'a'
-  0x00,0x00,0x06,0x00,0x00,0x38,0x00,0x01,0xC0,0x00,0x0E,0x00,0x00,0x70,0x00,0x03,0x80,0x00,0x1C,0x00,0x00,0xE0,0x00,0x07,0x00,0x00,0x38,0x00,0x01,0xC0,0x00,0x0E,0x00,0x00,0x60,0x00,0x02,0xFF,0xFF,0x17,0xFF,0xFA,0xC0,0x00,0x37,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x80,0x01,0xDC,0x00,0x0E,0xE0,0x00,0x77,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xED,0xFF,0xFB,0x1F,0xFF,0xE0,0xFF,0xFF,0x00, // 'b'
-  0x00,0x00,0x03,0xFF,0xFC,0xBF,0xFF,0xCC,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0D,0xFF,0xF8,0x3F,0xFF,0xC3,0xFF,0xFC, // 'c'
-  0x00,0x00,0x00,0x00,0x01,0x80,0x00,0x1C,0x00,0x00,0xE0,0x00,0x07,0x00,0x00,0x38,0x00,0x01,0xC0,0x00,0x0E,0x00,0x00,0x70,0x00,0x03,0x80,0x00,0x1C,0x00,0x00,0xE0,0x00,0x07,0x00,0x00,0x18,0xFF,0xFF,0x57,0xFF,0xFA,0xC0,0x00,0x37,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x80,0x01,0xDC,0x00,0x0E,0xE0,0x00,0x77,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xED,0xFF,0xFB,0x1F,0xFF,0xE0,0xFF,0xFF,0x00, // 'd'
-  0x3F,0xFF,0xC3,0xFF,0xFC,0xDF,0xFF,0x8E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xC0,0x00,0x0B,0xFF,0xFC,0xBF,0xFF,0xCC,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0D,0xFF,0xF8,0x3F,0xFF,0xC3,0xFF,0xFC, // 'e'
-  0x3F,0xFF,0xC3,0xFF,0xFC,0xDF,0xFF,0x8E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xC0,0x00,0x0B,0xFF,0xFC,0xBF,0xFF,0xCC,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0C,0x00,0x00,0x00,0x00,0x00, // 'f'
-  0x3F,0xFF,0xC1,0xFF,0xFE,0x37,0xFF,0xE1,0xC0,0x00,0x0E,0x00,0x00,0x70,0x00,0x03,0x80,0x00,0x1C,0x00,0x00,0xE0,0x00,0x07,0x00,0x00,0x38,0x00,0x01,0xC0,0x00,0x0E,0x00,0x00,0x70,0x00,0x03,0x00,0x00,0x10,0x00,0x00,0x80,0x00,0x16,0x00,0x01,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x80,0x01,0xDC,0x00,0x0E,0xE0,0x00,0x77,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x6F,0xFF,0xD8,0xFF,0xFF,0x07,0xFF,0xF8, // 'g'
-  0x00,0x00,0x06,0x00,0x00,0x38,0x00,0x01,0xC0,0x00,0x0E,0x00,0x00,0x70,0x00,0x03,0x80,0x00,0x1C,0x00,0x00,0xE0,0x00,0x07,0x00,0x00,0x38,0x00,0x01,0xC0,0x00,0x0E,0x00,0x00,0x60,0x00,0x02,0xFF,0xFF,0x17,0xFF,0xFA,0xC0,0x00,0x37,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x80,0x01,0xDC,0x00,0x0E,0xE0,0x00,0x77,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xEC,0x00,0x03,0x00,0x00,0x00, // 'h'
-  0x26,0xEE,0xEE,0xEE,0xEE,0xEE,0xE6,0x00, // 'i'
-  0x00,0x00,0x00,0x00,0x01,0x80,0x00,0x1C,0x00,0x00,0xE0,0x00,0x07,0x00,0x00,0x38,0x00,0x01,0xC0,0x00,0x0E,0x00,0x00,0x70,0x00,0x03,0x80,0x00,0x1C,0x00,0x00,0xE0,0x00,0x07,0x00,0x00,0x18,0x00,0x00,0x50,0x00,0x02,0xC0,0x00,0x37,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x80,0x01,0xDC,0x00,0x0E,0xE0,0x00,0x77,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xED,0xFF,0xFB,0x1F,0xFF,0xE0,0xFF,0xFF,0x00, // 'j'
-  0x3F,0xFF,0xC1,0xFF,0xFE,0x37,0xFF,0xE1,0xC0,0x00,0x0E,0x00,0x00,0x70,0x00,0x03,0x80,0x00,0x1C,0x00,0x00,0xE0,0x00,0x07,0x00,0x00,0x38,0x00,0x01,0xC0,0x00,0x0E,0x00,0x00,0x70,0x00,0x03,0x00,0x00,0x17,0xFF,0xF8,0xBF,0xFF,0xD6,0x00,0x01,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x80,0x01,0xDC,0x00,0x0E,0xE0,0x00,0x77,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x60,0x00,0x18,0x00,0x00,0x00, // 'k'
-  0x00,0x00,0x0C,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0C,0x00,0x00,0x80,0x00,0x08,0x00,0x00,0xC0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xDF,0xFF,0x83,0xFF,0xFC,0x3F,0xFF,0xC0, // 'l'
-  0x3F,0xFF,0xC1,0xFF,0xFE,0x37,0xFF,0xED,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x80,0x01,0xDC,0x00,0x0E,0xE0,0x00,0x77,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x00,0x00,0xD0,0x00,0x02,0x80,0x00,0x16,0x00,0x01,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x80,0x01,0xDC,0x00,0x0E,0xE0,0x00,0x77,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x60,0x00,0x18,0x00,0x00,0x00, // 'm'
-  0x00,0x00,0x01,0xFF,0xFE,0x2F,0xFF,0xF5,0x80,0x00,0x6E,0x00,0x07,0x70,0x00,0x3B,0x80,0x01,0xDC,0x00,0x0E,0xE0,0x00,0x77,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x80,0x01,0xD8,0x00,0x06,0x00,0x00,0x00, // 'n'
-  0x00,0x00,0x01,0xFF,0xFE,0x2F,0xFF,0xF5,0x80,0x00,0x6E,0x00,0x07,0x70,0x00,0x3B,0x80,0x01,0xDC,0x00,0x0E,0xE0,0x00,0x77,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x80,0x01,0xDB,0xFF,0xF6,0x3F,0xFF,0xC1,0xFF,0xFE,0x00, // 'o'
-  0x3F,0xFF,0xC1,0xFF,0xFE,0x37,0xFF,0xED,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x80,0x01,0xDC,0x00,0x0E,0xE0,0x00,0x77,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x00,0x00,0xD7,0xFF,0xFA,0xBF,0xFF,0xC6,0x00,0x00,0x38,0x00,0x01,0xC0,0x00,0x0E,0x00,0x00,0x70,0x00,0x03,0x80,0x00,0x1C,0x00,0x00,0xE0,0x00,0x07,0x00,0x00,0x38,0x00,0x01,0xC0,0x00,0x0E,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x00, // 'p'
-  0x3F,0xFF,0xC1,0xFF,0xFE,0x37,0xFF,0xED,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x80,0x01,0xDC,0x00,0x0E,0xE0,0x00,0x77,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x00,0x00,0xD7,0xFF,0xFA,0x3F,0xFF,0xD0,0x00,0x01,0x80,0x00,0x1C,0x00,0x00,0xE0,0x00,0x07,0x00,0x00,0x38,0x00,0x01,0xC0,0x00,0x0E,0x00,0x00,0x70,0x00,0x03,0x80,0x00,0x1C,0x00,0x00,0xE0,0x00,0x07,0x00,0x00,0x18,0x00,0x00,0x00, // 'q'
-  0x00,0x00,0x07,0xFF,0xFA,0xFF,0xFF,0x60,0x00,0x0E,0x00,0x01,0xC0,0x00,0x38,0x00,0x07,0x00,0x00,0xE0,0x00,0x1C,0x00,0x03,0x80,0x00,0x70,0x00,0x0E,0x00,0x01,0xC0,0x00,0x38,0x00,0x06,0x00,0x00,0x00,0x00,0x00, // 'r'
-  0x00,0x00,0x06,0x00,0x00,0x38,0x00,0x01,0xC0,0x00,0x0E,0x00,0x00,0x70,0x00,0x03,0x80,0x00,0x1C,0x00,0x00,0xE0,0x00,0x07,0x00,0x00,0x38,0x00,0x01,0xC0,0x00,0x0E,0x00,0x00,0x60,0x00,0x02,0xFF,0xFF,0x07,0xFF,0xFA,0x00,0x00,0x30,0x00,0x03,0x80,0x00,0x1C,0x00,0x00,0xE0,0x00,0x07,0x00,0x00,0x38,0x00,0x01,0xC0,0x00,0x0E,0x00,0x00,0x70,0x00,0x03,0x80,0x00,0x1C,0x00,0x00,0xE1,0xFF,0xFB,0x1F,0xFF,0xE0,0xFF,0xFF,0x00, // 's'
-  0x00,0x00,0x0C,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0C,0x00,0x00,0xBF,0xFF,0xCB,0xFF,0xFC,0xC0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xE0,0x00,0x0E,0x00,0x00,0xDF,0xFF,0x83,0xFF,0xFC,0x3F,0xFF,0xC0, // 't'
-  0x80,0x00,0x16,0x00,0x01,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x80,0x01,0xDC,0x00,0x0E,0xE0,0x00,0x77,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x6F,0xFF,0xD8,0xFF,0xFF,0x07,0xFF,0xF8, // 'u'
-  0x00,0x00,0x06,0x00,0x01,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x80,0x01,0xDC,0x00,0x0E,0xE0,0x00,0x77,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x60,0x00,0x1A,0x00,0x00,0x50,0x00,0x02,0xC0,0x00,0x37,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x80,0x01,0xDC,0x00,0x0E,0xE0,0x00,0x77,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xED,0xFF,0xFB,0x1F,0xFF,0xE0,0xFF,0xFF,0x00, // 'v'
-  0x00,0x00,0x06,0x00,0x01,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x80,0x01,0xDC,0x00,0x0E,0xE0,0x00,0x77,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x60,0x00,0x1A,0xFF,0xFF,0x57,0xFF,0xFA,0xC0,0x00,0x37,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x80,0x01,0xDC,0x00,0x0E,0xE0,0x00,0x77,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xED,0xFF,0xFB,0x1F,0xFF,0xE0,0xFF,0xFF,0x00, // 'w'
-  0x00,0x00,0x06,0x00,0x01,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x80,0x01,0xDC,0x00,0x0E,0xE0,0x00,0x77,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x60,0x00,0x1A,0xFF,0xFF,0x57,0xFF,0xFA,0xC0,0x00,0x37,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x80,0x01,0xDC,0x00,0x0E,0xE0,0x00,0x77,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xEC,0x00,0x03,0x00,0x00,0x00, // 'x'
-  0x00,0x00,0x06,0x00,0x01,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x70,0x00,0x3B,0x80,0x01,0xDC,0x00,0x0E,0xE0,0x00,0x77,0x00,0x03,0xB8,0x00,0x1D,0xC0,0x00,0xEE,0x00,0x07,0x60,0x00,0x1A,0xFF,0xFF,0x47,0xFF,0xFA,0x00,0x00,0x30,0x00,0x03,0x80,0x00,0x1C,0x00,0x00,0xE0,0x00,0x07,0x00,0x00,0x38,0x00,0x01,0xC0,0x00,0x0E,0x00,0x00,0x70,0x00,0x03,0x80,0x00,0x1C,0x00,0x00,0xE1,0xFF,0xFB,0x1F,0xFF,0xE0,0xFF,0xFF,0x00, // 'y'
-  0x3F,0xFF,0xC1,0xFF,0xFE,0x07,0xFF,0xEC,0x00,0x00,0xE0,0x00,0x07,0x00,0x00,0x38,0x00,0x01,0xC0,0x00,0x0E,0x00,0x00,0x70,0x00,0x03,0x80,0x00,0x1C,0x00,0x00,0xE0,0x00,0x07,0x00,0x00,0x38,0x00,0x00,0xC0,0x00,0x02,0x80,0x00,0x06,0x00,0x00,0x38,0x00,0x01,0xC0,0x00,0x0E,0x00,0x00,0x70,0x00,0x03,0x80,0x00,0x1C,0x00,0x00,0xE0,0x00,0x07,0x00,0x00,0x38,0x00,0x01,0xC0,0x00,0x0E,0x00,0x00,0x6F,0xFF,0xC0,0xFF,0xFF,0x07,0xFF,0xF8, // 'z'
-  0xFF,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x2F,0xF0, // '{'
-  0xFF,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x2F,0xF0, // '|'
-  0xFF,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x2F,0xF0 // '}'
-};
-const GFXglyph DSEG7_Classic_Regular_32Glyphs[] PROGMEM = {
-// bitmapOffset, width, height, xAdvance, xOffset, yOffset
-    {     0,   1,   1,   7,    0,    0 }, // ' '
-    {     1,   1,   1,  27,    0,    0 }, // '!'
-    {     2,   9,  21,  13,    1,  -21 }, // '"'
-    {    26,   9,  21,  13,    1,  -21 }, // '#'
-    {    50,   9,  21,  13,    1,  -21 }, // '$'
-    {    74,   9,  21,  13,    1,  -21 }, // '%'
-    {    98,   9,  21,  13,    1,  -21 }, // '&'
-    {   122,   9,  21,  13,    1,  -21 }, // '''
-    {   146,   9,  21,  13,    1,  -21 }, // '('
-    {   170,   9,  21,  13,    1,  -21 }, // ')'
-    {   194,   9,  21,  13,    1,  -21 }, // '*'
-    {   218,   9,  21,  13,    1,  -21 }, // '+'
-    {   242,   9,  21,  13,    1,  -21 }, // ','
-    {   266,  17,   3,  27,    5,  -18 }, // '-'
-    {   273,   5,   4,   1,   -2,   -4 }, // '.'
-    {   276,   9,  21,  13,    1,  -21 }, // '/'
-    {   300,  21,  32,  27,    3,  -32 }, // '0'
-    {   384,   4,  30,  27,   20,  -31 }, // '1'
-    {   399,  21,  32,  27,    3,  -32 }, // '2'
-    {   483,  19,  32,  27,    5,  -32 }, // '3'
-    {   559,  21,  30,  27,    3,  -31 }, // '4'
-    {   638,  21,  32,  27,    3,  -32 }, // '5'
-    {   722,  21,  32,  27,    3,  -32 }, // '6'
-    {   806,  21,  31,  27,    3,  -32 }, // '7'
-    {   888,  21,  32,  27,    3,  -32 }, // '8'
-    {   972,  21,  32,  27,    3,  -32 }, // '9'
-    {  1056,   5,  17,   7,    1,  -24 }, // ':'
-    {  1067,   9,  21,  13,    1,  -21 }, // ';'
-    {  1091,   9,  21,  13,    1,  -21 }, // '<'
-    {  1115,   9,  21,  13,    1,  -21 }, // '='
-    {  1139,   9,  21,  13,    1,  -21 }, // '>'
-    {  1163,   9,  21,  13,    1,  -21 }, // '?'
-    {  1187,   9,  21,  13,    1,  -21 }, // '@'
-    {  1211,  21,  31,  27,    3,  -32 }, // 'A'
-    {  1293,  21,  31,  27,    3,  -31 }, // 'B'
-    {  1375,  20,  18,  27,    3,  -18 }, // 'C'
-    {  1420,  21,  31,  27,    3,  -31 }, // 'D'
-    {  1502,  20,  32,  27,    3,  -32 }, // 'E'
-    {  1582,  20,  31,  27,    3,  -32 }, // 'F'
-    {  1660,  21,  32,  27,    3,  -32 }, // 'G'
-    {  1744,  21,  30,  27,    3,  -31 }, // 'H'
-    {  1823,   4,  15,  27,   20,  -16 }, // 'I'
-    {  1831,  21,  31,  27,    3,  -31 }, // 'J'
-    {  1913,  21,  31,  27,    3,  -32 }, // 'K'
-    {  1995,  20,  31,  27,    3,  -31 }, // 'L'
-    {  2073,  21,  31,  27,    3,  -32 }, // 'M'
-    {  2155,  21,  17,  27,    3,  -18 }, // 'N'
-    {  2200,  21,  18,  27,    3,  -18 }, // 'O'
-    {  2248,  21,  31,  27,    3,  -32 }, // 'P'
-    {  2330,  21,  31,  27,    3,  -32 }, // 'Q'
-    {  2412,  19,  17,  27,    3,  -18 }, // 'R'
-    {  2453,  21,  31,  27,    3,  -31 }, // 'S'
-    {  2535,  20,  31,  27,    3,  -31 }, // 'T'
-    {  2613,  21,  16,  27,    3,  -16 }, // 'U'
-    {  2655,  21,  31,  27,    3,  -31 }, // 'V'
-    {  2737,  21,  31,  27,    3,  -31 }, // 'W'
-    {  2819,  21,  30,  27,    3,  -31 }, // 'X'
-    {  2898,  21,  31,  27,    3,  -31 }, // 'Y'
-    {  2980,  21,  32,  27,    3,  -32 }, // 'Z'
-    {  3064,   9,  21,  13,    1,  -21 }, // '['
-    {  3088,   9,  21,  13,    1,  -21 }, // '\'
-    {  3112,   9,  21,  13,    1,  -21 }, // ']'
-    {  3136,   9,  21,  13,    1,  -21 }, // '^'
-    {  3160,   9,  21,  13,    1,  -21 }, // '_'
-    {  3184,   9,  21,  13,    1,  -21 }, // '`'
-    {  3208,  21,  31,  27,    3,  -32 }, // 'a'
-    {  3290,  21,  31,  27,    3,  -31 }, // 'b'
-    {  3372,  20,  18,  27,    3,  -18 }, // 'c'
-    {  3417,  21,  31,  27,    3,  -31 }, // 'd'
-    {  3499,  20,  32,  27,    3,  -32 }, // 'e'
-    {  3579,  20,  31,  27,    3,  -32 }, // 'f'
-    {  3657,  21,  32,  27,    3,  -32 }, // 'g'
-    {  3741,  21,  30,  27,    3,  -31 }, // 'h'
-    {  3820,   4,  15,  27,   20,  -16 }, // 'i'
-    {  3828,  21,  31,  27,    3,  -31 }, // 'j'
-    {  3910,  21,  31,  27,    3,  -32 }, // 'k'
-    {  3992,  20,  31,  27,    3,  -31 }, // 'l'
-    {  4070,  21,  31,  27,    3,  -32 }, // 'm'
-    {  4152,  21,  17,  27,    3,  -18 }, // 'n'
-    {  4197,  21,  18,  27,    3,  -18 }, // 'o'
-    {  4245,  21,  31,  27,    3,  -32 }, // 'p'
-    {  4327,  21,  31,  27,    3,  -32 }, // 'q'
-    {  4409,  19,  17,  27,    3,  -18 }, // 'r'
-    {  4450,  21,  31,  27,    3,  -31 }, // 's'
-    {  4532,  20,  31,  27,    3,  -31 }, // 't'
-    {  4610,  21,  16,  27,    3,  -16 }, // 'u'
-    {  4652,  21,  31,  27,    3,  -31 }, // 'v'
-    {  4734,  21,  31,  27,    3,  -31 }, // 'w'
-    {  4816,  21,  30,  27,    3,  -31 }, // 'x'
-    {  4895,  21,  31,  27,    3,  -31 }, // 'y'
-    {  4977,  21,  32,  27,    3,  -32 }, // 'z'
-    {  5061,   9,  21,  13,    1,  -21 }, // '{'
-    {  5085,   9,  21,  13,    1,  -21 }, // '|'
-    {  5109,   9,  21,  13,    1,  -21 } // '}'
-};
-const GFXfont DSEG7_Classic_Regular_32 PROGMEM = {
-(uint8_t  *)DSEG7_Classic_Regular_32Bitmaps,(GFXglyph *)DSEG7_Classic_Regular_32Glyphs,0x20, 0x7E, 35};
-
-// Created by http://oleddisplay.squix.ch/ Consider a donation
-// In case of problems make sure that you are using the font file with the correct version!
-const uint8_t DSEG7_Classic_Regular_28Bitmaps[] PROGMEM = {
-
-  // Bitmap Data:
-  0x00, // ' '
-  0x00, // '!'
-  0xFF,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xBF,0xC0, // '"'
-  0xFF,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xBF,0xC0, // '#'
-  0xFF,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xBF,0xC0, // '$'
-  0xFF,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xBF,0xC0, // '%'
-  0xFF,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xBF,0xC0, // '&'
-  0xFF,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xBF,0xC0, // '''
-  0xFF,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xBF,0xC0, // '('
-  0xFF,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xBF,0xC0, // ')'
-  0xFF,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xBF,0xC0, // '*'
-  0xFF,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xBF,0xC0, // '+'
-  0xFF,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xBF,0xC0, // ','
-  0x7F,0xFC,0x7F,0xFC, // '-'
-  0xF7,0x98, // '.'
-  0xFF,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xBF,0xC0, // '/'
-  0x7F,0xFE,0x2F,0xFF,0x8D,0xFF,0xDB,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x01,0xA0,0x00,0x28,0x00,0x0B,0x00,0x06,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB7,0xFF,0x6B,0xFF,0xE1,0xFF,0xF8, // '0'
-  0x06,0xEE,0xEE,0xEE,0xEE,0xE6,0x22,0x6E,0xEE,0xEE,0xEE,0xEE,0x60, // '1'
-  0x7F,0xFE,0x0F,0xFF,0x81,0xFF,0xD8,0x00,0x0E,0x00,0x03,0x80,0x00,0xE0,0x00,0x38,0x00,0x0E,0x00,0x03,0x80,0x00,0xE0,0x00,0x38,0x00,0x0E,0x00,0x01,0x8F,0xFF,0xAB,0xFF,0xE3,0x00,0x00,0xC0,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,0x00,0xC0,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,0x00,0xC0,0x00,0x37,0xFF,0x0B,0xFF,0xE1,0xFF,0xF8, // '2'
-  0xFF,0xFC,0x3F,0xFE,0x0F,0xFE,0xC0,0x00,0xE0,0x00,0x70,0x00,0x38,0x00,0x1C,0x00,0x0E,0x00,0x07,0x00,0x03,0x80,0x01,0xC0,0x00,0xE0,0x00,0x33,0xFF,0xE9,0xFF,0xF4,0x00,0x06,0x00,0x07,0x00,0x03,0x80,0x01,0xC0,0x00,0xE0,0x00,0x70,0x00,0x38,0x00,0x1C,0x00,0x0E,0x00,0x07,0x1F,0xFD,0x9F,0xFF,0x1F,0xFF,0x80, // '3'
-  0x80,0x00,0x30,0x00,0x6C,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x06,0xBF,0xFE,0x8F,0xFF,0xA0,0x00,0x18,0x00,0x0E,0x00,0x03,0x80,0x00,0xE0,0x00,0x38,0x00,0x0E,0x00,0x03,0x80,0x00,0xE0,0x00,0x38,0x00,0x0E,0x00,0x01,0x80,0x00,0x00, // '4'
-  0x7F,0xFE,0x2F,0xFF,0x8D,0xFF,0xC3,0x00,0x00,0xC0,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,0x00,0xC0,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,0x00,0xC0,0x00,0x2F,0xFF,0x83,0xFF,0xE8,0x00,0x06,0x00,0x03,0x80,0x00,0xE0,0x00,0x38,0x00,0x0E,0x00,0x03,0x80,0x00,0xE0,0x00,0x38,0x00,0x0E,0x00,0x03,0x87,0xFF,0x63,0xFF,0xE1,0xFF,0xF8, // '5'
-  0x7F,0xFE,0x2F,0xFF,0x8D,0xFF,0xC3,0x00,0x00,0xC0,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,0x00,0xC0,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,0x00,0xC0,0x00,0x2F,0xFF,0x8B,0xFF,0xEB,0x00,0x06,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB7,0xFF,0x6B,0xFF,0xE1,0xFF,0xF8, // '6'
-  0x7F,0xFE,0x2F,0xFF,0x8D,0xFF,0xDB,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x01,0xA0,0x00,0x20,0x00,0x08,0x00,0x06,0x00,0x03,0x80,0x00,0xE0,0x00,0x38,0x00,0x0E,0x00,0x03,0x80,0x00,0xE0,0x00,0x38,0x00,0x0E,0x00,0x03,0x80,0x00,0x60,0x00,0x00, // '7'
-  0x7F,0xFE,0x2F,0xFF,0x8D,0xFF,0xDB,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x01,0xAF,0xFF,0xAB,0xFF,0xEB,0x00,0x06,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB7,0xFF,0x6B,0xFF,0xE1,0xFF,0xF8, // '8'
-  0x7F,0xFE,0x2F,0xFF,0x8D,0xFF,0xDB,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x01,0xAF,0xFF,0xA3,0xFF,0xE8,0x00,0x06,0x00,0x03,0x80,0x00,0xE0,0x00,0x38,0x00,0x0E,0x00,0x03,0x80,0x00,0xE0,0x00,0x38,0x00,0x0E,0x00,0x03,0x87,0xFF,0x63,0xFF,0xE1,0xFF,0xF8, // '9'
-  0xE7,0xB8,0x00,0x00,0x00,0x00,0x00,0x8E,0x71,0x80, // ':'
-  0xFF,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xBF,0xC0, // ';'
-  0xFF,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xBF,0xC0, // '<'
-  0xFF,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xBF,0xC0, // '='
-  0xFF,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xBF,0xC0, // '>'
-  0xFF,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xBF,0xC0, // '?'
-  0xFF,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xBF,0xC0, // '@'
-  0x7F,0xFE,0x2F,0xFF,0x8D,0xFF,0xDB,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x01,0xAF,0xFF,0xAB,0xFF,0xEB,0x00,0x06,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0x68,0x00,0x00, // 'A'
-  0x80,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,0x00,0xC0,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,0x00,0xC0,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,0x00,0xBF,0xFE,0x2F,0xFF,0xAC,0x00,0x1B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xDF,0xFD,0xAF,0xFF,0x87,0xFF,0xE0, // 'B'
-  0x3F,0xFE,0x5F,0xFF,0x30,0x00,0x18,0x00,0x0C,0x00,0x06,0x00,0x03,0x00,0x01,0x80,0x00,0xC0,0x00,0x60,0x00,0x30,0x00,0x18,0x00,0x0D,0xFF,0xC5,0xFF,0xF1,0xFF,0xF8, // 'C'
-  0x00,0x00,0x00,0x00,0x60,0x00,0x38,0x00,0x0E,0x00,0x03,0x80,0x00,0xE0,0x00,0x38,0x00,0x0E,0x00,0x03,0x80,0x00,0xE0,0x00,0x38,0x00,0x06,0x3F,0xFE,0xAF,0xFF,0xAC,0x00,0x1B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xDF,0xFD,0xAF,0xFF,0x87,0xFF,0xE0, // 'D'
-  0x7F,0xFE,0x5F,0xFF,0x37,0xFF,0x18,0x00,0x0C,0x00,0x06,0x00,0x03,0x00,0x01,0x80,0x00,0xC0,0x00,0x60,0x00,0x30,0x00,0x18,0x00,0x0C,0x00,0x05,0xFF,0xF2,0xFF,0xF9,0x80,0x00,0xC0,0x00,0x60,0x00,0x30,0x00,0x18,0x00,0x0C,0x00,0x06,0x00,0x03,0x00,0x01,0x80,0x00,0xC0,0x00,0x6F,0xFE,0x2F,0xFF,0x8F,0xFF,0xC0, // 'E'
-  0x7F,0xFE,0x5F,0xFF,0x37,0xFF,0x18,0x00,0x0C,0x00,0x06,0x00,0x03,0x00,0x01,0x80,0x00,0xC0,0x00,0x60,0x00,0x30,0x00,0x18,0x00,0x0C,0x00,0x05,0xFF,0xF2,0xFF,0xF9,0x80,0x00,0xC0,0x00,0x60,0x00,0x30,0x00,0x18,0x00,0x0C,0x00,0x06,0x00,0x03,0x00,0x01,0x80,0x00,0xC0,0x00,0x60,0x00,0x20,0x00,0x00, // 'F'
-  0x7F,0xFE,0x2F,0xFF,0x8D,0xFF,0xC3,0x00,0x00,0xC0,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,0x00,0xC0,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,0x00,0xC0,0x00,0x20,0x00,0x08,0x00,0x0B,0x00,0x06,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB7,0xFF,0x6B,0xFF,0xE1,0xFF,0xF8, // 'G'
-  0x80,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,0x00,0xC0,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,0x00,0xC0,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,0x00,0xBF,0xFE,0x2F,0xFF,0xAC,0x00,0x1B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x01,0xA0,0x00,0x00, // 'H'
-  0x26,0xEE,0xEE,0xEE,0xEE,0xE6,0x00, // 'I'
-  0x00,0x00,0x00,0x00,0x60,0x00,0x38,0x00,0x0E,0x00,0x03,0x80,0x00,0xE0,0x00,0x38,0x00,0x0E,0x00,0x03,0x80,0x00,0xE0,0x00,0x38,0x00,0x06,0x00,0x00,0xA0,0x00,0x2C,0x00,0x1B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xDF,0xFD,0xAF,0xFF,0x87,0xFF,0xE0, // 'J'
-  0x7F,0xFE,0x2F,0xFF,0x8D,0xFF,0xC3,0x00,0x00,0xC0,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,0x00,0xC0,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,0x00,0xC0,0x00,0x2F,0xFF,0x8B,0xFF,0xEB,0x00,0x06,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0x68,0x00,0x00, // 'K'
-  0x80,0x00,0x60,0x00,0x30,0x00,0x18,0x00,0x0C,0x00,0x06,0x00,0x03,0x00,0x01,0x80,0x00,0xC0,0x00,0x60,0x00,0x30,0x00,0x18,0x00,0x08,0x00,0x04,0x00,0x03,0x00,0x01,0x80,0x00,0xC0,0x00,0x60,0x00,0x30,0x00,0x18,0x00,0x0C,0x00,0x06,0x00,0x03,0x00,0x01,0x80,0x00,0xDF,0xFC,0x5F,0xFF,0x1F,0xFF,0x80, // 'L'
-  0x7F,0xFE,0x2F,0xFF,0x8D,0xFF,0xDB,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x01,0xA0,0x00,0x28,0x00,0x0B,0x00,0x06,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0x68,0x00,0x00, // 'M'
-  0x3F,0xFE,0x2F,0xFF,0xAC,0x00,0x1B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x01,0xA0,0x00,0x00, // 'N'
-  0x3F,0xFE,0x2F,0xFF,0xAC,0x00,0x1B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xDF,0xFD,0xAF,0xFF,0x87,0xFF,0xE0, // 'O'
-  0x7F,0xFE,0x2F,0xFF,0x8D,0xFF,0xDB,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x01,0xAF,0xFF,0xAB,0xFF,0xE3,0x00,0x00,0xC0,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,0x00,0xC0,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,0x00,0xC0,0x00,0x30,0x00,0x08,0x00,0x00, // 'P'
-  0x7F,0xFE,0x2F,0xFF,0x8D,0xFF,0xDB,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x01,0xAF,0xFF,0xA3,0xFF,0xE8,0x00,0x06,0x00,0x03,0x80,0x00,0xE0,0x00,0x38,0x00,0x0E,0x00,0x03,0x80,0x00,0xE0,0x00,0x38,0x00,0x0E,0x00,0x03,0x80,0x00,0x60,0x00,0x00, // 'Q'
-  0x3F,0xFE,0x5F,0xFF,0x30,0x00,0x18,0x00,0x0C,0x00,0x06,0x00,0x03,0x00,0x01,0x80,0x00,0xC0,0x00,0x60,0x00,0x30,0x00,0x18,0x00,0x0C,0x00,0x04,0x00,0x00, // 'R'
-  0x80,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,0x00,0xC0,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,0x00,0xC0,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,0x00,0xBF,0xFE,0x0F,0xFF,0xA0,0x00,0x18,0x00,0x0E,0x00,0x03,0x80,0x00,0xE0,0x00,0x38,0x00,0x0E,0x00,0x03,0x80,0x00,0xE0,0x00,0x38,0x00,0x0E,0x1F,0xFD,0x8F,0xFF,0x87,0xFF,0xE0, // 'S'
-  0x80,0x00,0x60,0x00,0x30,0x00,0x18,0x00,0x0C,0x00,0x06,0x00,0x03,0x00,0x01,0x80,0x00,0xC0,0x00,0x60,0x00,0x30,0x00,0x18,0x00,0x0B,0xFF,0xE5,0xFF,0xF3,0x00,0x01,0x80,0x00,0xC0,0x00,0x60,0x00,0x30,0x00,0x18,0x00,0x0C,0x00,0x06,0x00,0x03,0x00,0x01,0x80,0x00,0xDF,0xFC,0x5F,0xFF,0x1F,0xFF,0x80, // 'T'
-  0x80,0x00,0xB0,0x00,0x6C,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x7F,0xF6,0xBF,0xFE,0x1F,0xFF,0x80, // 'U'
-  0x80,0x00,0x30,0x00,0x6C,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x06,0x80,0x00,0xA0,0x00,0x2C,0x00,0x1B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xDF,0xFD,0xAF,0xFF,0x87,0xFF,0xE0, // 'V'
-  0x80,0x00,0x30,0x00,0x6C,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x06,0xBF,0xFE,0xAF,0xFF,0xAC,0x00,0x1B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xDF,0xFD,0xAF,0xFF,0x87,0xFF,0xE0, // 'W'
-  0x80,0x00,0x30,0x00,0x6C,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x06,0xBF,0xFE,0xAF,0xFF,0xAC,0x00,0x1B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x01,0xA0,0x00,0x00, // 'X'
-  0x80,0x00,0x30,0x00,0x6C,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x06,0xBF,0xFE,0x8F,0xFF,0xA0,0x00,0x18,0x00,0x0E,0x00,0x03,0x80,0x00,0xE0,0x00,0x38,0x00,0x0E,0x00,0x03,0x80,0x00,0xE0,0x00,0x38,0x00,0x0E,0x1F,0xFD,0x8F,0xFF,0x87,0xFF,0xE0, // 'Y'
-  0x7F,0xFE,0x0F,0xFF,0x81,0xFF,0xD8,0x00,0x0E,0x00,0x03,0x80,0x00,0xE0,0x00,0x38,0x00,0x0E,0x00,0x03,0x80,0x00,0xE0,0x00,0x38,0x00,0x0E,0x00,0x01,0x80,0x00,0x28,0x00,0x03,0x00,0x00,0xC0,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,0x00,0xC0,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,0x00,0xC0,0x00,0x37,0xFF,0x0B,0xFF,0xE1,0xFF,0xF8, // 'Z'
-  0xFF,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xBF,0xC0, // '['
-  0xFF,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xBF,0xC0, // '\'
-  0xFF,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xBF,0xC0, // ']'
-  0xFF,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xBF,0xC0, // '^'
-  0xFF,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xBF,0xC0, // '_'
-  0xFF,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xBF,0xC0, // '`'
-  0x7F,0xFE,0x2F,0xFF,0x8D,0xFF,0xDB,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x01,0xAF,0xFF,0xAB,0xFF,0xEB,0x00,0x06,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0x68,0x00,0x00, // 'a'
-  0x80,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,0x00,0xC0,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,0x00,0xC0,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,0x00,0xBF,0xFE,0x2F,0xFF,0xAC,0x00,0x1B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xDF,0xFD,0xAF,0xFF,0x87,0xFF,0xE0, // 'b'
-  0x3F,0xFE,0x5F,0xFF,0x30,0x00,0x18,0x00,0x0C,0x00,0x06,0x00,0x03,0x00,0x01,0x80,0x00,0xC0,0x00,0x60,0x00,0x30,0x00,0x18,0x00,0x0D,0xFF,0xC5,0xFF,0xF1,0xFF,0xF8, // 'c'
-  0x00,0x00,0x00,0x00,0x60,0x00,0x38,0x00,0x0E,0x00,0x03,0x80,0x00,0xE0,0x00,0x38,0x00,0x0E,0x00,0x03,0x80,0x00,0xE0,0x00,0x38,0x00,0x06,0x3F,0xFE,0xAF,0xFF,0xAC,0x00,0x1B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xDF,0xFD,0xAF,0xFF,0x87,0xFF,0xE0, // 'd'
-  0x7F,0xFE,0x5F,0xFF,0x37,0xFF,0x18,0x00,0x0C,0x00,0x06,0x00,0x03,0x00,0x01,0x80,0x00,0xC0,0x00,0x60,0x00,0x30,0x00,0x18,0x00,0x0C,0x00,0x05,0xFF,0xF2,0xFF,0xF9,0x80,0x00,0xC0,0x00,0x60,0x00,0x30,0x00,0x18,0x00,0x0C,0x00,0x06,0x00,0x03,0x00,0x01,0x80,0x00,0xC0,0x00,0x6F,0xFE,0x2F,0xFF,0x8F,0xFF,0xC0, // 'e'
-  0x7F,0xFE,0x5F,0xFF,0x37,0xFF,0x18,0x00,0x0C,0x00,0x06,0x00,0x03,0x00,0x01,0x80,0x00,0xC0,0x00,0x60,0x00,0x30,0x00,0x18,0x00,0x0C,0x00,0x05,0xFF,0xF2,0xFF,0xF9,0x80,0x00,0xC0,0x00,0x60,0x00,0x30,0x00,0x18,0x00,0x0C,0x00,0x06,0x00,0x03,0x00,0x01,0x80,0x00,0xC0,0x00,0x60,0x00,0x20,0x00,0x00, // 'f'
-  0x7F,0xFE,0x2F,0xFF,0x8D,0xFF,0xC3,0x00,0x00,0xC0,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,0x00,0xC0,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,0x00,0xC0,0x00,0x20,0x00,0x08,0x00,0x0B,0x00,0x06,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB7,0xFF,0x6B,0xFF,0xE1,0xFF,0xF8, // 'g'
-  0x80,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,0x00,0xC0,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,0x00,0xC0,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,0x00,0xBF,0xFE,0x2F,0xFF,0xAC,0x00,0x1B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x01,0xA0,0x00,0x00, // 'h'
-  0x26,0xEE,0xEE,0xEE,0xEE,0xE6,0x00, // 'i'
-  0x00,0x00,0x00,0x00,0x60,0x00,0x38,0x00,0x0E,0x00,0x03,0x80,0x00,0xE0,0x00,0x38,0x00,0x0E,0x00,0x03,0x80,0x00,0xE0,0x00,0x38,0x00,0x06,0x00,0x00,0xA0,0x00,0x2C,0x00,0x1B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xDF,0xFD,0xAF,0xFF,0x87,0xFF,0xE0, // 'j'
-  0x7F,0xFE,0x2F,0xFF,0x8D,0xFF,0xC3,0x00,0x00,0xC0,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,0x00,0xC0,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,0x00,0xC0,0x00,0x2F,0xFF,0x8B,0xFF,0xEB,0x00,0x06,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0x68,0x00,0x00, // 'k'
-  0x80,0x00,0x60,0x00,0x30,0x00,0x18,0x00,0x0C,0x00,0x06,0x00,0x03,0x00,0x01,0x80,0x00,0xC0,0x00,0x60,0x00,0x30,0x00,0x18,0x00,0x08,0x00,0x04,0x00,0x03,0x00,0x01,0x80,0x00,0xC0,0x00,0x60,0x00,0x30,0x00,0x18,0x00,0x0C,0x00,0x06,0x00,0x03,0x00,0x01,0x80,0x00,0xDF,0xFC,0x5F,0xFF,0x1F,0xFF,0x80, // 'l'
-  0x7F,0xFE,0x2F,0xFF,0x8D,0xFF,0xDB,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x01,0xA0,0x00,0x28,0x00,0x0B,0x00,0x06,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0x68,0x00,0x00, // 'm'
-  0x3F,0xFE,0x2F,0xFF,0xAC,0x00,0x1B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x01,0xA0,0x00,0x00, // 'n'
-  0x3F,0xFE,0x2F,0xFF,0xAC,0x00,0x1B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xDF,0xFD,0xAF,0xFF,0x87,0xFF,0xE0, // 'o'
-  0x7F,0xFE,0x2F,0xFF,0x8D,0xFF,0xDB,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x01,0xAF,0xFF,0xAB,0xFF,0xE3,0x00,0x00,0xC0,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,0x00,0xC0,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,0x00,0xC0,0x00,0x30,0x00,0x08,0x00,0x00, // 'p'
-  0x7F,0xFE,0x2F,0xFF,0x8D,0xFF,0xDB,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x01,0xAF,0xFF,0xA3,0xFF,0xE8,0x00,0x06,0x00,0x03,0x80,0x00,0xE0,0x00,0x38,0x00,0x0E,0x00,0x03,0x80,0x00,0xE0,0x00,0x38,0x00,0x0E,0x00,0x03,0x80,0x00,0x60,0x00,0x00, // 'q'
-  0x3F,0xFE,0x5F,0xFF,0x30,0x00,0x18,0x00,0x0C,0x00,0x06,0x00,0x03,0x00,0x01,0x80,0x00,0xC0,0x00,0x60,0x00,0x30,0x00,0x18,0x00,0x0C,0x00,0x04,0x00,0x00, // 'r'
-  0x80,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,0x00,0xC0,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,0x00,0xC0,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,0x00,0xBF,0xFE,0x0F,0xFF,0xA0,0x00,0x18,0x00,0x0E,0x00,0x03,0x80,0x00,0xE0,0x00,0x38,0x00,0x0E,0x00,0x03,0x80,0x00,0xE0,0x00,0x38,0x00,0x0E,0x1F,0xFD,0x8F,0xFF,0x87,0xFF,0xE0, // 's'
-  0x80,0x00,0x60,0x00,0x30,0x00,0x18,0x00,0x0C,0x00,0x06,0x00,0x03,0x00,0x01,0x80,0x00,0xC0,0x00,0x60,0x00,0x30,0x00,0x18,0x00,0x0B,0xFF,0xE5,0xFF,0xF3,0x00,0x01,0x80,0x00,0xC0,0x00,0x60,0x00,0x30,0x00,0x18,0x00,0x0C,0x00,0x06,0x00,0x03,0x00,0x01,0x80,0x00,0xDF,0xFC,0x5F,0xFF,0x1F,0xFF,0x80, // 't'
-  0x80,0x00,0xB0,0x00,0x6C,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x7F,0xF6,0xBF,0xFE,0x1F,0xFF,0x80, // 'u'
-  0x80,0x00,0x30,0x00,0x6C,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x06,0x80,0x00,0xA0,0x00,0x2C,0x00,0x1B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xDF,0xFD,0xAF,0xFF,0x87,0xFF,0xE0, // 'v'
-  0x80,0x00,0x30,0x00,0x6C,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x06,0xBF,0xFE,0xAF,0xFF,0xAC,0x00,0x1B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xDF,0xFD,0xAF,0xFF,0x87,0xFF,0xE0, // 'w'
-  0x80,0x00,0x30,0x00,0x6C,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x06,0xBF,0xFE,0xAF,0xFF,0xAC,0x00,0x1B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x01,0xA0,0x00,0x00, // 'x'
-  0x80,0x00,0x30,0x00,0x6C,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x06,0xBF,0xFE,0x8F,0xFF,0xA0,0x00,0x18,0x00,0x0E,0x00,0x03,0x80,0x00,0xE0,0x00,0x38,0x00,0x0E,0x00,0x03,0x80,0x00,0xE0,0x00,0x38,0x00,0x0E,0x1F,0xFD,0x8F,0xFF,0x87,0xFF,0xE0, // 'y'
-  0x7F,0xFE,0x0F,0xFF,0x81,0xFF,0xD8,0x00,0x0E,0x00,0x03,0x80,0x00,0xE0,0x00,0x38,0x00,0x0E,0x00,0x03,0x80,0x00,0xE0,0x00,0x38,0x00,0x0E,0x00,0x01,0x80,0x00,0x28,0x00,0x03,0x00,0x00,0xC0,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,0x00,0xC0,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,0x00,0xC0,0x00,0x37,0xFF,0x0B,0xFF,0xE1,0xFF,0xF8, // 'z'
-  0xFF,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xBF,0xC0, // '{'
-  0xFF,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xBF,0xC0, // '|'
-  0xFF,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xA0,0x50,0x28,0x14,0x0A,0x05,0x02,0x81,0x40,0xBF,0xC0 // '}'
-};
-const GFXglyph DSEG7_Classic_Regular_28Glyphs[] PROGMEM = {
-// bitmapOffset, width, height, xAdvance, xOffset, yOffset
-    {     0,   1,   1,   7,    0,    0 }, // ' '
-    {     1,   1,   1,  24,    0,    0 }, // '!'
-    {     2,   9,  19,  11,    1,  -19 }, // '"'
-    {    24,   9,  19,  11,    1,  -19 }, // '#'
-    {    46,   9,  19,  11,    1,  -19 }, // '$'
-    {    68,   9,  19,  11,    1,  -19 }, // '%'
-    {    90,   9,  19,  11,    1,  -19 }, // '&'
-    {   112,   9,  19,  11,    1,  -19 }, // '''
-    {   134,   9,  19,  11,    1,  -19 }, // '('
-    {   156,   9,  19,  11,    1,  -19 }, // ')'
-    {   178,   9,  19,  11,    1,  -19 }, // '*'
-    {   200,   9,  19,  11,    1,  -19 }, // '+'
-    {   222,   9,  19,  11,    1,  -19 }, // ','
-    {   244,  16,   2,  24,    4,  -15 }, // '-'
-    {   248,   5,   3,   1,   -2,   -3 }, // '.'
-    {   250,   9,  19,  11,    1,  -19 }, // '/'
-    {   272,  18,  28,  24,    3,  -28 }, // '0'
-    {   335,   4,  26,  24,   17,  -27 }, // '1'
-    {   348,  18,  28,  24,    3,  -28 }, // '2'
-    {   411,  17,  28,  24,    4,  -28 }, // '3'
-    {   471,  18,  26,  24,    3,  -27 }, // '4'
-    {   530,  18,  28,  24,    3,  -28 }, // '5'
-    {   593,  18,  28,  24,    3,  -28 }, // '6'
-    {   656,  18,  27,  24,    3,  -28 }, // '7'
-    {   717,  18,  28,  24,    3,  -28 }, // '8'
-    {   780,  18,  28,  24,    3,  -28 }, // '9'
-    {   843,   5,  15,   7,    1,  -21 }, // ':'
-    {   853,   9,  19,  11,    1,  -19 }, // ';'
-    {   875,   9,  19,  11,    1,  -19 }, // '<'
-    {   897,   9,  19,  11,    1,  -19 }, // '='
-    {   919,   9,  19,  11,    1,  -19 }, // '>'
-    {   941,   9,  19,  11,    1,  -19 }, // '?'
-    {   963,   9,  19,  11,    1,  -19 }, // '@'
-    {   985,  18,  27,  24,    3,  -28 }, // 'A'
-    {  1046,  18,  27,  24,    3,  -27 }, // 'B'
-    {  1107,  17,  15,  24,    3,  -15 }, // 'C'
-    {  1139,  18,  27,  24,    3,  -27 }, // 'D'
-    {  1200,  17,  28,  24,    3,  -28 }, // 'E'
-    {  1260,  17,  27,  24,    3,  -28 }, // 'F'
-    {  1318,  18,  28,  24,    3,  -28 }, // 'G'
-    {  1381,  18,  26,  24,    3,  -27 }, // 'H'
-    {  1440,   4,  13,  24,   17,  -14 }, // 'I'
-    {  1447,  18,  27,  24,    3,  -27 }, // 'J'
-    {  1508,  18,  27,  24,    3,  -28 }, // 'K'
-    {  1569,  17,  27,  24,    3,  -27 }, // 'L'
-    {  1627,  18,  27,  24,    3,  -28 }, // 'M'
-    {  1688,  18,  14,  24,    3,  -15 }, // 'N'
-    {  1720,  18,  15,  24,    3,  -15 }, // 'O'
-    {  1754,  18,  27,  24,    3,  -28 }, // 'P'
-    {  1815,  18,  27,  24,    3,  -28 }, // 'Q'
-    {  1876,  17,  14,  24,    3,  -15 }, // 'R'
-    {  1906,  18,  27,  24,    3,  -27 }, // 'S'
-    {  1967,  17,  27,  24,    3,  -27 }, // 'T'
-    {  2025,  18,  14,  24,    3,  -14 }, // 'U'
-    {  2057,  18,  27,  24,    3,  -27 }, // 'V'
-    {  2118,  18,  27,  24,    3,  -27 }, // 'W'
-    {  2179,  18,  26,  24,    3,  -27 }, // 'X'
-    {  2238,  18,  27,  24,    3,  -27 }, // 'Y'
-    {  2299,  18,  28,  24,    3,  -28 }, // 'Z'
-    {  2362,   9,  19,  11,    1,  -19 }, // '['
-    {  2384,   9,  19,  11,    1,  -19 }, // '\'
-    {  2406,   9,  19,  11,    1,  -19 }, // ']'
-    {  2428,   9,  19,  11,    1,  -19 }, // '^'
-    {  2450,   9,  19,  11,    1,  -19 }, // '_'
-    {  2472,   9,  19,  11,    1,  -19 }, // '`'
-    {  2494,  18,  27,  24,    3,  -28 }, // 'a'
-    {  2555,  18,  27,  24,    3,  -27 }, // 'b'
-    {  2616,  17,  15,  24,    3,  -15 }, // 'c'
-    {  2648,  18,  27,  24,    3,  -27 }, // 'd'
-    {  2709,  17,  28,  24,    3,  -28 }, // 'e'
-    {  2769,  17,  27,  24,    3,  -28 }, // 'f'
-    {  2827,  18,  28,  24,    3,  -28 }, // 'g'
-    {  2890,  18,  26,  24,    3,  -27 }, // 'h'
-    {  2949,   4,  13,  24,   17,  -14 }, // 'i'
-    {  2956,  18,  27,  24,    3,  -27 }, // 'j'
-    {  3017,  18,  27,  24,    3,  -28 }, // 'k'
-    {  3078,  17,  27,  24,    3,  -27 }, // 'l'
-    {  3136,  18,  27,  24,    3,  -28 }, // 'm'
-    {  3197,  18,  14,  24,    3,  -15 }, // 'n'
-    {  3229,  18,  15,  24,    3,  -15 }, // 'o'
-    {  3263,  18,  27,  24,    3,  -28 }, // 'p'
-    {  3324,  18,  27,  24,    3,  -28 }, // 'q'
-    {  3385,  17,  14,  24,    3,  -15 }, // 'r'
-    {  3415,  18,  27,  24,    3,  -27 }, // 's'
-    {  3476,  17,  27,  24,    3,  -27 }, // 't'
-    {  3534,  18,  14,  24,    3,  -14 }, // 'u'
-    {  3566,  18,  27,  24,    3,  -27 }, // 'v'
-    {  3627,  18,  27,  24,    3,  -27 }, // 'w'
-    {  3688,  18,  26,  24,    3,  -27 }, // 'x'
-    {  3747,  18,  27,  24,    3,  -27 }, // 'y'
-    {  3808,  18,  28,  24,    3,  -28 }, // 'z'
-    {  3871,   9,  19,  11,    1,  -19 }, // '{'
-    {  3893,   9,  19,  11,    1,  -19 }, // '|'
-    {  3915,   9,  19,  11,    1,  -19 } // '}'
-};
-const GFXfont DSEG7_Classic_Regular_28 PROGMEM = {
-(uint8_t  *)DSEG7_Classic_Regular_28Bitmaps,(GFXglyph *)DSEG7_Classic_Regular_28Glyphs,0x20, 0x7E, 31};
+#include "UI-aafont.h"
+
+// DSEG7_Modern_Bold_20: "0123456789ACHTW" (15/94 glyphs, 727 bytes, 원본 2797 bytes)
+const uint8_t DSEG7_Modern_Bold_20Bitmaps[] PROGMEM = {
+  0xFF,0xE5,0xFE,0xB0,0x0D,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x36,0x00,0x00,0x0D,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x36,0x01,0xAF,0xF9,0xFF,0xE0, // '0'
+  0x0B,0x6D,0xB6,0xC3,0x6D,0xB6,0xD8,0x00, // '1'
+  0xFF,0xE1,0xFE,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x06,0x00,0x31,0xFE,0x0F,0xF1,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x06,0x00,0x2F,0xF9,0xFF,0xE0, // '2'
+  0xFF,0xE1,0xFE,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x06,0x00,0x31,0xFE,0x0F,0xFC,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x06,0x00,0x30,0x01,0x8F,0xF8,0xFF,0xE0, // '3'
+  0x00,0x04,0x00,0xB0,0x0D,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x37,0xFE,0x0F,0xFC,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x06,0x00,0x30,0x01,0x80,0x00, // '4'
+  0xFF,0xE5,0xFE,0x30,0x01,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x07,0xFE,0x0F,0xFC,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x06,0x00,0x30,0x01,0x8F,0xF8,0xFF,0xE0, // '5'
+  0xFF,0xE5,0xFE,0x30,0x01,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x07,0xFE,0x0F,0xFD,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x36,0x01,0xAF,0xF9,0xFF,0xE0, // '6'
+  0xFF,0xE5,0xFE,0xB0,0x0D,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x36,0x00,0x00,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x06,0x00,0x30,0x01,0x80,0x00, // '7'
+  0xFF,0xE5,0xFE,0xB0,0x0D,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x37,0xFE,0x0F,0xFD,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x36,0x01,0xAF,0xF9,0xFF,0xE0, // '8'
+  0xFF,0xE5,0xFE,0xB0,0x0D,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x37,0xFE,0x0F,0xFC,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x06,0x00,0x30,0x01,0x8F,0xF8,0xFF,0xE0, // '9'
+  0xFF,0xE5,0xFE,0xB0,0x0D,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x37,0xFE,0x0F,0xFD,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x36,0x01,0xA0,0x01,0x00,0x00, // 'A'
+  0x3F,0xC1,0xFE,0x30,0x01,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x05,0xFF,0x3F,0xFC, // 'C'
+  0x80,0x06,0x00,0x30,0x01,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0xFF,0xC1,0xFF,0xB0,0x0D,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x34,0x00,0x20,0x00, // 'H'
+  0x80,0x06,0x00,0x30,0x01,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0xFF,0xC1,0xFE,0x30,0x01,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x05,0xFF,0x3F,0xFC, // 'T'
+  0x00,0x04,0x00,0xB0,0x0D,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x37,0xFE,0x0F,0xFD,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x36,0x01,0xAF,0xF9,0xFF,0xE0 // 'W'
+};
+const GFXglyph DSEG7_Modern_Bold_20Glyphs[] PROGMEM = {
+// bitmapOffset, width, height, xAdvance, xOffset, yOffset
+    {     0,  13,  20,  17,    2,  -20 }, // '0'
+    {    33,   3,  19,  17,   12,  -20 }, // '1'
+    {    41,  13,  20,  17,    2,  -20 }, // '2'
+    {    74,  13,  20,  17,    2,  -20 }, // '3'
+    {   107,  13,  19,  17,    2,  -20 }, // '4'
+    {   138,  13,  20,  17,    2,  -20 }, // '5'
+    {   171,  13,  20,  17,    2,  -20 }, // '6'
+    {   204,  13,  19,  17,    2,  -20 }, // '7'
+    {   235,  13,  20,  17,    2,  -20 }, // '8'
+    {   268,  13,  20,  17,    2,  -20 }, // '9'
+    {     0,   0,  21,   5,    1,  -20 }, // ':' (미사용, 기준선 유지)
+    {     0,   0,  14,   8,    1,  -14 }, // ';' (미사용)
+    {     0,   0,  14,   8,    1,  -14 }, // '<' (미사용)
+    {     0,   0,  14,   8,    1,  -14 }, // '=' (미사용)
+    {     0,   0,  14,   8,    1,  -14 }, // '>' (미사용)
+    {     0,   0,  14,   8,    1,  -14 }, // '?' (미사용)
+    {     0,   0,  14,   8,    1,  -14 }, // '@' (미사용)
+    {   301,  13,  20,  17,    2,  -20 }, // 'A'
+    {     0,   0,  19,  17,    2,  -19 }, // 'B' (미사용)
+    {   334,  13,  11,  17,    2,  -11 }, // 'C'
+    {     0,   0,  20,  17,    2,  -20 }, // 'D' (미사용)
+    {     0,   0,  20,  17,    2,  -20 }, // 'E' (미사용)
+    {     0,   0,  20,  17,    2,  -20 }, // 'F' (미사용)
+    {     0,   0,  20,  17,    2,  -20 }, // 'G' (미사용)
+    {   352,  13,  19,  17,    2,  -19 }, // 'H'
+    {     0,   0,  10,  17,   12,  -11 }, // 'I' (미사용)
+    {     0,   0,  20,  17,    2,  -20 }, // 'J' (미사용)
+    {     0,   0,  20,  17,    2,  -20 }, // 'K' (미사용)
+    {     0,   0,  19,  17,    2,  -19 }, // 'L' (미사용)
+    {     0,   0,  20,  17,    2,  -20 }, // 'M' (미사용)
+    {     0,   0,  11,  17,    2,  -11 }, // 'N' (미사용)
+    {     0,   0,  11,  17,    2,  -11 }, // 'O' (미사용)
+    {     0,   0,  20,  17,    2,  -20 }, // 'P' (미사용)
+    {     0,   0,  19,  17,    2,  -20 }, // 'Q' (미사용)
+    {     0,   0,  11,  17,    2,  -11 }, // 'R' (미사용)
+    {     0,   0,  19,  17,    2,  -19 }, // 'S' (미사용)
+    {   383,  13,  19,  17,    2,  -19 }, // 'T'
+    {     0,   0,  11,  17,    2,  -11 }, // 'U' (미사용)
+    {     0,   0,  20,  17,    2,  -20 }, // 'V' (미사용)
+    {   414,  13,  20,  17,    2,  -20 } // 'W'
+};
+const GFXfont DSEG7_Modern_Bold_20 PROGMEM = {
+(uint8_t  *)DSEG7_Modern_Bold_20Bitmaps,(GFXglyph *)DSEG7_Modern_Bold_20Glyphs,0x30, 0x57, 22};
+
+// DSEG7_Modern_Bold_20AA: 2bpp RLE, 21행 칸 (1189 bytes)
+const uint8_t DSEG7_Modern_Bold_20AARuns[] PROGMEM = {
+  0x01,0x80,0xC9,0x40,0x04,0xC0,0x40,0x80,0xC5,0x80,0x40,0xC0,0x04,0xC0,0x80,0x40,0x05,0x40,0x80,0xC0,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x07,0x81,0x04,0x81,0x18,0x81,0x04,0x81,0x07,0xC1,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x07,0xC1,0x04,0xC0,0x80,0x40,0x05,0x40,0xC0,0x80,0x04,0xC0,0x40,0x80,0xC7,0x05,0x80,0xCA,0x13, // '0'
+  0x1C,0x40,0xC0,0x0E,0x80,0xC0,0x0E,0xC1,0x0E,0xC1,0x0E,0xC1,0x0E,0xC1,0x0E,0xC1,0x0E,0x81,0x1F,0x81,0x0E,0xC1,0x0E,0xC1,0x0E,0xC1,0x0E,0xC1,0x0E,0xC1,0x0E,0xC1,0x0E,0x81,0x35, // '1'
+  0x01,0xCA,0x40,0x05,0x40,0x80,0xC5,0x80,0x40,0xC0,0x0D,0x40,0x80,0xC0,0x0E,0xC1,0x0E,0xC1,0x0E,0xC1,0x0E,0xC1,0x0E,0xC1,0x0D,0x40,0x81,0x06,0x80,0xC5,0x80,0x40,0x06,0x40,0x80,0xC5,0x80,0x06,0x81,0x40,0x0D,0xC1,0x0E,0xC1,0x0E,0xC1,0x0E,0xC1,0x0E,0xC1,0x0E,0xC0,0x80,0x40,0x0D,0xC0,0x40,0x80,0xC6,0x80,0x40,0x04,0x80,0xCA,0x13, // '2'
+  0x01,0xCA,0x40,0x05,0x40,0x80,0xC5,0x80,0x40,0xC0,0x0D,0x40,0x80,0xC0,0x0E,0xC1,0x0E,0xC1,0x0E,0xC1,0x0E,0xC1,0x0E,0xC1,0x0D,0x40,0x81,0x06,0x80,0xC5,0x80,0x08,0x80,0xC7,0x80,0x0D,0x40,0xC1,0x0E,0xC1,0x0E,0xC1,0x0E,0xC1,0x0E,0xC1,0x0E,0xC1,0x0D,0x40,0xC0,0x80,0x05,0x40,0x80,0xC7,0x06,0xCA,0x13, // '3'
+  0x12,0xC0,0x40,0x07,0x40,0xC0,0x04,0xC0,0x80,0x07,0x80,0xC0,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x40,0x05,0x40,0x81,0x04,0x80,0xC7,0x80,0x07,0x40,0x80,0xC7,0x80,0x0D,0x40,0xC1,0x0E,0xC1,0x0E,0xC1,0x0E,0xC1,0x0E,0xC1,0x0E,0xC1,0x0E,0x81,0x35, // '4'
+  0x01,0x80,0xC9,0x05,0xC0,0x40,0x80,0xC5,0x80,0x40,0x05,0xC0,0x80,0x40,0x0D,0xC1,0x0E,0xC1,0x0E,0xC1,0x0E,0xC1,0x0E,0xC1,0x0E,0xC1,0x40,0x0D,0x80,0xC7,0x80,0x40,0x06,0x40,0x80,0xC7,0x80,0x0D,0x40,0xC1,0x0E,0xC1,0x0E,0xC1,0x0E,0xC1,0x0E,0xC1,0x0E,0xC1,0x0D,0x40,0xC0,0x80,0x05,0x40,0x80,0xC7,0x06,0xCA,0x13, // '5'
+  0x01,0x80,0xC9,0x05,0xC0,0x40,0x80,0xC5,0x80,0x40,0x05,0xC0,0x80,0x40,0x0D,0xC1,0x0E,0xC1,0x0E,0xC1,0x0E,0xC1,0x0E,0xC1,0x0E,0xC1,0x40,0x0D,0x80,0xC7,0x80,0x40,0x07,0x80,0xC7,0x80,0x04,0x81,0x40,0x05,0x40,0xC1,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x07,0xC1,0x04,0xC0,0x80,0x40,0x05,0x40,0xC0,0x80,0x04,0xC0,0x40,0x80,0xC7,0x05,0x80,0xCA,0x13, // '6'
+  0x01,0x80,0xC9,0x40,0x04,0xC0,0x40,0x80,0xC5,0x80,0x40,0xC0,0x04,0xC0,0x80,0x40,0x05,0x40,0x80,0xC0,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x07,0x81,0x04,0x81,0x18,0x81,0x0E,0xC1,0x0E,0xC1,0x0E,0xC1,0x0E,0xC1,0x0E,0xC1,0x0E,0xC1,0x0E,0x81,0x35, // '7'
+  0x01,0x80,0xC9,0x40,0x04,0xC0,0x40,0x80,0xC5,0x80,0x40,0xC0,0x04,0xC0,0x80,0x40,0x05,0x40,0x80,0xC0,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x40,0x05,0x40,0x81,0x04,0x80,0xC7,0x80,0x08,0x80,0xC7,0x80,0x04,0x81,0x40,0x05,0x40,0xC1,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x07,0xC1,0x04,0xC0,0x80,0x40,0x05,0x40,0xC0,0x80,0x04,0xC0,0x40,0x80,0xC7,0x05,0x80,0xCA,0x13, // '8'
+  0x01,0x80,0xC9,0x40,0x04,0xC0,0x40,0x80,0xC5,0x80,0x40,0xC0,0x04,0xC0,0x80,0x40,0x05,0x40,0x80,0xC0,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x40,0x05,0x40,0x81,0x04,0x80,0xC7,0x80,0x07,0x40,0x80,0xC7,0x80,0x0D,0x40,0xC1,0x0E,0xC1,0x0E,0xC1,0x0E,0xC1,0x0E,0xC1,0x0E,0xC1,0x0D,0x40,0xC0,0x80,0x05,0x40,0x80,0xC7,0x06,0xCA,0x13, // '9'
+  0x01,0x80,0xC9,0x40,0x04,0xC0,0x40,0x80,0xC5,0x80,0x40,0xC0,0x04,0xC0,0x80,0x40,0x05,0x40,0x80,0xC0,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x40,0x05,0x40,0x81,0x04,0x80,0xC7,0x80,0x08,0x80,0xC7,0x80,0x04,0x81,0x40,0x05,0x40,0xC1,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x07,0xC1,0x04,0xC0,0x80,0x07,0x81,0x04,0xC0,0x40,0x0E,0xC0,0x1E, // 'A'
+  0x3F,0x3F,0x1C,0x80,0xC5,0x80,0x07,0x40,0x80,0xC5,0x80,0x06,0x81,0x40,0x0D,0xC1,0x0E,0xC1,0x0E,0xC1,0x0E,0xC1,0x0E,0xC1,0x0E,0xC0,0x80,0x40,0x0D,0xC0,0x40,0x80,0xC6,0x80,0x40,0x04,0x80,0xCA,0x13, // 'C'
+  0x12,0xC0,0x40,0x0E,0xC0,0x80,0x0E,0xC1,0x0E,0xC1,0x0E,0xC1,0x0E,0xC1,0x0E,0xC1,0x0E,0xC1,0x40,0x0D,0x80,0xC7,0x80,0x40,0x07,0x80,0xC7,0x80,0x04,0x81,0x40,0x05,0x40,0xC1,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x07,0xC1,0x04,0xC0,0x80,0x07,0x81,0x04,0xC0,0x40,0x0E,0xC0,0x1E, // 'H'
+  0x12,0xC0,0x40,0x0E,0xC0,0x80,0x0E,0xC1,0x0E,0xC1,0x0E,0xC1,0x0E,0xC1,0x0E,0xC1,0x0E,0xC1,0x40,0x0D,0x80,0xC7,0x80,0x08,0x80,0xC5,0x80,0x06,0x81,0x40,0x0D,0xC1,0x0E,0xC1,0x0E,0xC1,0x0E,0xC1,0x0E,0xC1,0x0E,0xC0,0x80,0x40,0x0D,0xC0,0x40,0x80,0xC6,0x80,0x40,0x04,0x80,0xCA,0x13, // 'T'
+  0x12,0xC0,0x40,0x07,0x40,0xC0,0x04,0xC0,0x80,0x07,0x80,0xC0,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x40,0x05,0x40,0x81,0x04,0x80,0xC7,0x80,0x08,0x80,0xC7,0x80,0x04,0x81,0x40,0x05,0x40,0xC1,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x07,0xC1,0x04,0xC1,0x07,0xC1,0x04,0xC0,0x80,0x40,0x05,0x40,0xC0,0x80,0x04,0xC0,0x40,0x80,0xC7,0x05,0x80,0xCA,0x13 // 'W'
+};
+const AAGlyph DSEG7_Modern_Bold_20AAGlyphs[] PROGMEM = {
+// offset, advance (0 = 없음)
+    {     0,  17 }, // '0'
+    {    89,  17 }, // '1'
+    {   124,  17 }, // '2'
+    {   189,  17 }, // '3'
+    {   248,  17 }, // '4'
+    {   311,  17 }, // '5'
+    {   372,  17 }, // '6'
+    {   451,  17 }, // '7'
+    {   514,  17 }, // '8'
+    {   611,  17 }, // '9'
+    {     0,   0 }, // ':'
+    {     0,   0 }, // ';'
+    {     0,   0 }, // '<'
+    {     0,   0 }, // '='
+    {     0,   0 }, // '>'
+    {     0,   0 }, // '?'
+    {     0,   0 }, // '@'
+    {   690,  17 }, // 'A'
+    {     0,   0 }, // 'B'
+    {   781,  17 }, // 'C'
+    {     0,   0 }, // 'D'
+    {     0,   0 }, // 'E'
+    {     0,   0 }, // 'F'
+    {     0,   0 }, // 'G'
+    {   820,  17 }, // 'H'
+    {     0,   0 }, // 'I'
+    {     0,   0 }, // 'J'
+    {     0,   0 }, // 'K'
+    {     0,   0 }, // 'L'
+    {     0,   0 }, // 'M'
+    {     0,   0 }, // 'N'
+    {     0,   0 }, // 'O'
+    {     0,   0 }, // 'P'
+    {     0,   0 }, // 'Q'
+    {     0,   0 }, // 'R'
+    {     0,   0 }, // 'S'
+    {   885,  17 }, // 'T'
+    {     0,   0 }, // 'U'
+    {     0,   0 }, // 'V'
+    {   940,  17 } // 'W'
+};
+const AAFont DSEG7_Modern_Bold_20AA PROGMEM = {
+DSEG7_Modern_Bold_20AARuns, DSEG7_Modern_Bold_20AAGlyphs, 0x30, 0x57, 20, 21};
+
+// DSEG7_Classic_Regular_28: "0123456789:ABEGMNPRTU" (21/94 glyphs, 1366 bytes, 원본 4595 bytes)
+const uint8_t DSEG7_Classic_Regular_28Bitmaps[] PROGMEM = {
+  0x7F,0xFE,0x2F,0xFF,0x8D,0xFF,0xDB,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x01,0xA0,0x00,0x28,0x00,0x0B,0x00,0x06,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB7,0xFF,0x6B,0xFF,0xE1,0xFF,0xF8, // '0'
+  0x06,0xEE,0xEE,0xEE,0xEE,0xE6,0x22,0x6E,0xEE,0xEE,0xEE,0xEE,0x60, // '1'
+  0x7F,0xFE,0x0F,0xFF,0x81,0xFF,0xD8,0x00,0x0E,0x00,0x03,0x80,0x00,0xE0,0x00,0x38,0x00,0x0E,0x00,0x03,0x80,0x00,0xE0,0x00,0x38,0x00,0x0E,0x00,0x01,0x8F,0xFF,0xAB,0xFF,0xE3,0x00,0x00,0xC0,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,0x00,0xC0,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,0x00,0xC0,0x00,0x37,0xFF,0x0B,0xFF,0xE1,0xFF,0xF8, // '2'
+  0xFF,0xFC,0x3F,0xFE,0x0F,0xFE,0xC0,0x00,0xE0,0x00,0x70,0x00,0x38,0x00,0x1C,0x00,0x0E,0x00,0x07,0x00,0x03,0x80,0x01,0xC0,0x00,0xE0,0x00,0x33,0xFF,0xE9,0xFF,0xF4,0x00,0x06,0x00,0x07,0x00,0x03,0x80,0x01,0xC0,0x00,0xE0,0x00,0x70,0x00,0x38,0x00,0x1C,0x00,0x0E,0x00,0x07,0x1F,0xFD,0x9F,0xFF,0x1F,0xFF,0x80, // '3'
+  0x80,0x00,0x30,0x00,0x6C,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x06,0xBF,0xFE,0x8F,0xFF,0xA0,0x00,0x18,0x00,0x0E,0x00,0x03,0x80,0x00,0xE0,0x00,0x38,0x00,0x0E,0x00,0x03,0x80,0x00,0xE0,0x00,0x38,0x00,0x0E,0x00,0x01,0x80,0x00,0x00, // '4'
+  0x7F,0xFE,0x2F,0xFF,0x8D,0xFF,0xC3,0x00,0x00,0xC0,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,0x00,0xC0,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,0x00,0xC0,0x00,0x2F,0xFF,0x83,0xFF,0xE8,0x00,0x06,0x00,0x03,0x80,0x00,0xE0,0x00,0x38,0x00,0x0E,0x00,0x03,0x80,0x00,0xE0,0x00,0x38,0x00,0x0E,0x00,0x03,0x87,0xFF,0x63,0xFF,0xE1,0xFF,0xF8, // '5'
+  0x7F,0xFE,0x2F,0xFF,0x8D,0xFF,0xC3,0x00,0x00,0xC0,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,0x00,0xC0,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,0x00,0xC0,0x00,0x2F,0xFF,0x8B,0xFF,0xEB,0x00,0x06,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB7,0xFF,0x6B,0xFF,0xE1,0xFF,0xF8, // '6'
+  0x7F,0xFE,0x2F,0xFF,0x8D,0xFF,0xDB,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x01,0xA0,0x00,0x20,0x00,0x08,0x00,0x06,0x00,0x03,0x80,0x00,0xE0,0x00,0x38,0x00,0x0E,0x00,0x03,0x80,0x00,0xE0,0x00,0x38,0x00,0x0E,0x00,0x03,0x80,0x00,0x60,0x00,0x00, // '7'
+  0x7F,0xFE,0x2F,0xFF,0x8D,0xFF,0xDB,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x01,0xAF,0xFF,0xAB,0xFF,0xEB,0x00,0x06,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB7,0xFF,0x6B,0xFF,0xE1,0xFF,0xF8, // '8'
+  0x7F,0xFE,0x2F,0xFF,0x8D,0xFF,0xDB,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x01,0xAF,0xFF,0xA3,0xFF,0xE8,0x00,0x06,0x00,0x03,0x80,0x00,0xE0,0x00,0x38,0x00,0x0E,0x00,0x03,0x80,0x00,0xE0,0x00,0x38,0x00,0x0E,0x00,0x03,0x87,0xFF,0x63,0xFF,0xE1,0xFF,0xF8, // '9'
+  0xE7,0xB8,0x00,0x00,0x00,0x00,0x00,0x8E,0x71,0x80, // ':'
+  0x7F,0xFE,0x2F,0xFF,0x8D,0xFF,0xDB,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x01,0xAF,0xFF,0xAB,0xFF,0xEB,0x00,0x06,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0x68,0x00,0x00, // 'A'
+  0x80,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,0x00,0xC0,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,0x00,0xC0,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,0x00,0xBF,0xFE,0x2F,0xFF,0xAC,0x00,0x1B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xDF,0xFD,0xAF,0xFF,0x87,0xFF,0xE0, // 'B'
+  0x7F,0xFE,0x5F,0xFF,0x37,0xFF,0x18,0x00,0x0C,0x00,0x06,0x00,0x03,0x00,0x01,0x80,0x00,0xC0,0x00,0x60,0x00,0x30,0x00,0x18,0x00,0x0C,0x00,0x05,0xFF,0xF2,0xFF,0xF9,0x80,0x00,0xC0,0x00,0x60,0x00,0x30,0x00,0x18,0x00,0x0C,0x00,0x06,0x00,0x03,0x00,0x01,0x80,0x00,0xC0,0x00,0x6F,0xFE,0x2F,0xFF,0x8F,0xFF,0xC0, // 'E'
+  0x7F,0xFE,0x2F,0xFF,0x8D,0xFF,0xC3,0x00,0x00,0xC0,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,0x00,0xC0,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,0x00,0xC0,0x00,0x20,0x00,0x08,0x00,0x0B,0x00,0x06,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB7,0xFF,0x6B,0xFF,0xE1,0xFF,0xF8, // 'G'
+  0x7F,0xFE,0x2F,0xFF,0x8D,0xFF,0xDB,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x01,0xA0,0x00,0x28,0x00,0x0B,0x00,0x06,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0x68,0x00,0x00, // 'M'
+  0x3F,0xFE,0x2F,0xFF,0xAC,0x00,0x1B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x01,0xA0,0x00,0x00, // 'N'
+  0x7F,0xFE,0x2F,0xFF,0x8D,0xFF,0xDB,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x01,0xAF,0xFF,0xAB,0xFF,0xE3,0x00,0x00,0xC0,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,0x00,0xC0,0x00,0x30,0x00,0x0C,0x00,0x03,0x00,0x00,0xC0,0x00,0x30,0x00,0x08,0x00,0x00, // 'P'
+  0x3F,0xFE,0x5F,0xFF,0x30,0x00,0x18,0x00,0x0C,0x00,0x06,0x00,0x03,0x00,0x01,0x80,0x00,0xC0,0x00,0x60,0x00,0x30,0x00,0x18,0x00,0x0C,0x00,0x04,0x00,0x00, // 'R'
+  0x80,0x00,0x60,0x00,0x30,0x00,0x18,0x00,0x0C,0x00,0x06,0x00,0x03,0x00,0x01,0x80,0x00,0xC0,0x00,0x60,0x00,0x30,0x00,0x18,0x00,0x0B,0xFF,0xE5,0xFF,0xF3,0x00,0x01,0x80,0x00,0xC0,0x00,0x60,0x00,0x30,0x00,0x18,0x00,0x0C,0x00,0x06,0x00,0x03,0x00,0x01,0x80,0x00,0xDF,0xFC,0x5F,0xFF,0x1F,0xFF,0x80, // 'T'
+  0x80,0x00,0xB0,0x00,0x6C,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x00,0x0E,0xC0,0x03,0xB0,0x00,0xEC,0x00,0x3B,0x7F,0xF6,0xBF,0xFE,0x1F,0xFF,0x80 // 'U'
+};
+const GFXglyph DSEG7_Classic_Regular_28Glyphs[] PROGMEM = {
+// bitmapOffset, width, height, xAdvance, xOffset, yOffset
+    {     0,  18,  28,  24,    3,  -28 }, // '0'
+    {    63,   4,  26,  24,   17,  -27 }, // '1'
+    {    76,  18,  28,  24,    3,  -28 }, // '2'
+    {   139,  17,  28,  24,    4,  -28 }, // '3'
+    {   199,  18,  26,  24,    3,  -27 }, // '4'
+    {   258,  18,  28,  24,    3,  -28 }, // '5'
+    {   321,  18,  28,  24,    3,  -28 }, // '6'
+    {   384,  18,  27,  24,    3,  -28 }, // '7'
+    {   445,  18,  28,  24,    3,  -28 }, // '8'
+    {   508,  18,  28,  24,    3,  -28 }, // '9'
+    {   571,   5,  15,   7,    1,  -21 }, // ':'
+    {     0,   0,  29,  11,    1,  -28 }, // ';' (미사용, 기준선 유지)
+    {     0,   0,  19,  11,    1,  -19 }, // '<' (미사용)
+    {     0,   0,  19,  11,    1,  -19 }, // '=' (미사용)
+    {     0,   0,  19,  11,    1,  -19 }, // '>' (미사용)
+    {     0,   0,  19,  11,    1,  -19 }, // '?' (미사용)
+    {     0,   0,  19,  11,    1,  -19 }, // '@' (미사용)
+    {   581,  18,  27,  24,    3,  -28 }, // 'A'
+    {   642,  18,  27,  24,    3,  -27 }, // 'B'
+    {     0,   0,  15,  24,    3,  -15 }, // 'C' (미사용)
+    {     0,   0,  27,  24,    3,  -27 }, // 'D' (미사용)
+    {   703,  17,  28,  24,    3,  -28 }, // 'E'
+    {     0,   0,  27,  24,    3,  -28 }, // 'F' (미사용)
+    {   763,  18,  28,  24,    3,  -28 }, // 'G'
+    {     0,   0,  26,  24,    3,  -27 }, // 'H' (미사용)
+    {     0,   0,  13,  24,   17,  -14 }, // 'I' (미사용)
+    {     0,   0,  27,  24,    3,  -27 }, // 'J' (미사용)
+    {     0,   0,  27,  24,    3,  -28 }, // 'K' (미사용)
+    {     0,   0,  27,  24,    3,  -27 }, // 'L' (미사용)
+    {   826,  18,  27,  24,    3,  -28 }, // 'M'
+    {   887,  18,  14,  24,    3,  -15 }, // 'N'
+    {     0,   0,  15,  24,    3,  -15 }, // 'O' (미사용)
+    {   919,  18,  27,  24,    3,  -28 }, // 'P'
+    {     0,   0,  27,  24,    3,  -28 }, // 'Q' (미사용)
+    {   980,  17,  14,  24,    3,  -15 }, // 'R'
+    {     0,   0,  27,  24,    3,  -27 }, // 'S' (미사용)
+    {  1010,  17,  27,  24,    3,  -27 }, // 'T'
+    {  1068,  18,  14,  24,    3,  -14 } // 'U'
+};
+const GFXfont DSEG7_Classic_Regular_28 PROGMEM = {
+(uint8_t  *)DSEG7_Classic_Regular_28Bitmaps,(GFXglyph *)DSEG7_Classic_Regular_28Glyphs,0x30, 0x55, 31};
+
+// DSEG7_Classic_Regular_28AA: 2bpp RLE, 29행 칸 (2231 bytes)
+const uint8_t DSEG7_Classic_Regular_28AARuns[] PROGMEM = {
+  0x02,0x40,0xCC,0x80,0x08,0xC0,0x40,0x80,0xCA,0x80,0x40,0x07,0xC0,0x80,0x00,0x80,0xC8,0x80,0x00,0x81,0x06,0xC1,0x0A,0x40,0x80,0xC1,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0x80,0xC1,0x06,0xC0,0x80,0x0B,0x40,0x80,0xC0,0x06,0xC0,0x40,0x0C,0x40,0xC0,0x06,0xC0,0x40,0x0C,0x40,0xC0,0x06,0xC0,0x80,0x0B,0x40,0x80,0xC0,0x06,0xC1,0x0B,0x80,0xC1,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0A,0x40,0x80,0xC1,0x06,0xC0,0x80,0x00,0x80,0xC8,0x80,0x00,0x81,0x06,0xC0,0x40,0x80,0xCA,0x80,0x40,0x07,0x40,0xCC,0x80,0x1D, // '0'
+  0x3F,0x00,0x40,0x81,0x14,0x80,0xC1,0x14,0xC2,0x14,0xC2,0x14,0xC2,0x14,0xC2,0x14,0xC2,0x14,0xC2,0x14,0xC2,0x14,0x80,0xC1,0x14,0x40,0x80,0xC0,0x15,0x40,0xC0,0x15,0x40,0xC0,0x14,0x40,0x80,0xC0,0x14,0x80,0xC1,0x14,0xC2,0x14,0xC2,0x14,0xC2,0x14,0xC2,0x14,0xC2,0x14,0xC2,0x14,0xC2,0x14,0x80,0xC1,0x14,0x40,0x81,0x3F,0x0B, // '1'
+  0x03,0xCC,0x80,0x09,0x40,0x80,0xCA,0x80,0x40,0x09,0x40,0x80,0xC8,0x80,0x00,0x81,0x13,0x40,0x80,0xC1,0x14,0xC2,0x14,0xC2,0x14,0xC2,0x14,0xC2,0x14,0xC2,0x14,0xC2,0x14,0xC2,0x14,0x80,0xC1,0x15,0x80,0xC0,0x08,0x80,0xCA,0x80,0x00,0xC0,0x06,0xC0,0x00,0x80,0xCA,0x80,0x08,0xC0,0x80,0x40,0x14,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC0,0x80,0x00,0x80,0xC8,0x80,0x40,0x08,0xC0,0x40,0x80,0xCA,0x80,0x08,0x40,0xCC,0x80,0x1D, // '2'
+  0x03,0xCC,0x80,0x09,0x40,0x80,0xCA,0x80,0x40,0x09,0x40,0x80,0xC8,0x80,0x00,0x81,0x13,0x40,0x80,0xC1,0x14,0xC2,0x14,0xC2,0x14,0xC2,0x14,0xC2,0x14,0xC2,0x14,0xC2,0x14,0xC2,0x14,0x80,0xC1,0x15,0x80,0xC0,0x08,0x80,0xCA,0x80,0x00,0xC0,0x08,0x80,0xCA,0x80,0x00,0xC0,0x15,0x80,0xC0,0x14,0x80,0xC1,0x14,0xC2,0x14,0xC2,0x14,0xC2,0x14,0xC2,0x14,0xC2,0x14,0xC2,0x14,0xC2,0x13,0x40,0x80,0xC1,0x08,0x40,0x80,0xC8,0x80,0x00,0x81,0x07,0x40,0x80,0xCA,0x80,0x40,0x08,0xCC,0x80,0x1D, // '3'
+  0x1A,0xC0,0x40,0x15,0xC0,0x80,0x0B,0x40,0x81,0x06,0xC1,0x0B,0x80,0xC1,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0x80,0xC1,0x06,0xC0,0x80,0x40,0x0B,0x80,0xC0,0x06,0xC0,0x00,0x80,0xCA,0x80,0x00,0xC0,0x08,0x80,0xCA,0x80,0x00,0xC0,0x15,0x80,0xC0,0x14,0x80,0xC1,0x14,0xC2,0x14,0xC2,0x14,0xC2,0x14,0xC2,0x14,0xC2,0x14,0xC2,0x14,0xC2,0x14,0x80,0xC1,0x14,0x40,0x81,0x3F,0x0B, // '4'
+  0x02,0x40,0xCC,0x80,0x08,0xC0,0x40,0x80,0xCA,0x80,0x08,0xC0,0x80,0x00,0x80,0xC8,0x80,0x40,0x08,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC0,0x80,0x40,0x14,0xC0,0x00,0x80,0xCA,0x80,0x0A,0x80,0xCA,0x80,0x00,0xC0,0x15,0x80,0xC0,0x14,0x80,0xC1,0x14,0xC2,0x14,0xC2,0x14,0xC2,0x14,0xC2,0x14,0xC2,0x14,0xC2,0x14,0xC2,0x13,0x40,0x80,0xC1,0x08,0x40,0x80,0xC8,0x80,0x00,0x81,0x07,0x40,0x80,0xCA,0x80,0x40,0x08,0xCC,0x80,0x1D, // '5'
+  0x02,0x40,0xCC,0x80,0x08,0xC0,0x40,0x80,0xCA,0x80,0x08,0xC0,0x80,0x00,0x80,0xC8,0x80,0x40,0x08,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC0,0x80,0x40,0x14,0xC0,0x00,0x80,0xCA,0x80,0x08,0xC0,0x00,0x80,0xCA,0x80,0x00,0xC0,0x06,0xC0,0x80,0x40,0x0B,0x80,0xC0,0x06,0xC1,0x0B,0x80,0xC1,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0A,0x40,0x80,0xC1,0x06,0xC0,0x80,0x00,0x80,0xC8,0x80,0x00,0x81,0x06,0xC0,0x40,0x80,0xCA,0x80,0x40,0x07,0x40,0xCC,0x80,0x1D, // '6'
+  0x02,0x40,0xCC,0x80,0x08,0xC0,0x40,0x80,0xCA,0x80,0x40,0x07,0xC0,0x80,0x00,0x80,0xC8,0x80,0x00,0x81,0x06,0xC1,0x0A,0x40,0x80,0xC1,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0x80,0xC1,0x06,0xC0,0x80,0x0B,0x40,0x80,0xC0,0x06,0xC0,0x40,0x0C,0x40,0xC0,0x15,0x40,0xC0,0x14,0x40,0x80,0xC0,0x14,0x80,0xC1,0x14,0xC2,0x14,0xC2,0x14,0xC2,0x14,0xC2,0x14,0xC2,0x14,0xC2,0x14,0xC2,0x14,0x80,0xC1,0x14,0x40,0x81,0x3F,0x0B, // '7'
+  0x02,0x40,0xCC,0x80,0x08,0xC0,0x40,0x80,0xCA,0x80,0x40,0x07,0xC0,0x80,0x00,0x80,0xC8,0x80,0x00,0x81,0x06,0xC1,0x0A,0x40,0x80,0xC1,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0x80,0xC1,0x06,0xC0,0x80,0x40,0x0B,0x80,0xC0,0x06,0xC0,0x00,0x80,0xCA,0x80,0x00,0xC0,0x06,0xC0,0x00,0x80,0xCA,0x80,0x00,0xC0,0x06,0xC0,0x80,0x40,0x0B,0x80,0xC0,0x06,0xC1,0x0B,0x80,0xC1,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0A,0x40,0x80,0xC1,0x06,0xC0,0x80,0x00,0x80,0xC8,0x80,0x00,0x81,0x06,0xC0,0x40,0x80,0xCA,0x80,0x40,0x07,0x40,0xCC,0x80,0x1D, // '8'
+  0x02,0x40,0xCC,0x80,0x08,0xC0,0x40,0x80,0xCA,0x80,0x40,0x07,0xC0,0x80,0x00,0x80,0xC8,0x80,0x00,0x81,0x06,0xC1,0x0A,0x40,0x80,0xC1,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0x80,0xC1,0x06,0xC0,0x80,0x40,0x0B,0x80,0xC0,0x06,0xC0,0x00,0x80,0xCA,0x80,0x00,0xC0,0x08,0x80,0xCA,0x80,0x00,0xC0,0x15,0x80,0xC0,0x14,0x80,0xC1,0x14,0xC2,0x14,0xC2,0x14,0xC2,0x14,0xC2,0x14,0xC2,0x14,0xC2,0x14,0xC2,0x13,0x40,0x80,0xC1,0x08,0x40,0x80,0xC8,0x80,0x00,0x81,0x07,0x40,0x80,0xCA,0x80,0x40,0x08,0xCC,0x80,0x1D, // '9'
+  0x31,0x80,0xC0,0x80,0x40,0x02,0xC3,0x02,0x80,0xC0,0x80,0x40,0x3A,0x40,0xC0,0x40,0x03,0x80,0xC0,0x80,0x03,0x80,0xC1,0x03,0x40,0x81,0x33, // ':'
+  0x02,0x40,0xCC,0x80,0x08,0xC0,0x40,0x80,0xCA,0x80,0x40,0x07,0xC0,0x80,0x00,0x80,0xC8,0x80,0x00,0x81,0x06,0xC1,0x0A,0x40,0x80,0xC1,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0x80,0xC1,0x06,0xC0,0x80,0x40,0x0B,0x80,0xC0,0x06,0xC0,0x00,0x80,0xCA,0x80,0x00,0xC0,0x06,0xC0,0x00,0x80,0xCA,0x80,0x00,0xC0,0x06,0xC0,0x80,0x40,0x0B,0x80,0xC0,0x06,0xC1,0x0B,0x80,0xC1,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0x80,0xC1,0x06,0xC0,0x80,0x0B,0x40,0x81,0x06,0xC0,0x40,0x3F,0x02, // 'A'
+  0x1A,0xC0,0x40,0x15,0xC0,0x80,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC0,0x80,0x40,0x14,0xC0,0x00,0x80,0xCA,0x80,0x08,0xC0,0x00,0x80,0xCA,0x80,0x00,0xC0,0x06,0xC0,0x80,0x40,0x0B,0x80,0xC0,0x06,0xC1,0x0B,0x80,0xC1,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0A,0x40,0x80,0xC1,0x06,0xC0,0x80,0x00,0x80,0xC8,0x80,0x00,0x81,0x06,0xC0,0x40,0x80,0xCA,0x80,0x40,0x07,0x40,0xCC,0x80,0x1D, // 'B'
+  0x02,0x40,0xCC,0x80,0x08,0xC0,0x40,0x80,0xCA,0x80,0x08,0xC0,0x80,0x00,0x80,0xC8,0x80,0x40,0x08,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC0,0x80,0x40,0x14,0xC0,0x00,0x80,0xCA,0x80,0x08,0xC0,0x00,0x80,0xCA,0x80,0x08,0xC0,0x80,0x40,0x14,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC0,0x80,0x00,0x80,0xC8,0x80,0x40,0x08,0xC0,0x40,0x80,0xCA,0x80,0x08,0x40,0xCC,0x80,0x1D, // 'E'
+  0x02,0x40,0xCC,0x80,0x08,0xC0,0x40,0x80,0xCA,0x80,0x08,0xC0,0x80,0x00,0x80,0xC8,0x80,0x40,0x08,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC0,0x80,0x15,0xC0,0x40,0x15,0xC0,0x40,0x0C,0x40,0xC0,0x06,0xC0,0x80,0x0B,0x40,0x80,0xC0,0x06,0xC1,0x0B,0x80,0xC1,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0A,0x40,0x80,0xC1,0x06,0xC0,0x80,0x00,0x80,0xC8,0x80,0x00,0x81,0x06,0xC0,0x40,0x80,0xCA,0x80,0x40,0x07,0x40,0xCC,0x80,0x1D, // 'G'
+  0x02,0x40,0xCC,0x80,0x08,0xC0,0x40,0x80,0xCA,0x80,0x40,0x07,0xC0,0x80,0x00,0x80,0xC8,0x80,0x00,0x81,0x06,0xC1,0x0A,0x40,0x80,0xC1,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0x80,0xC1,0x06,0xC0,0x80,0x0B,0x40,0x80,0xC0,0x06,0xC0,0x40,0x0C,0x40,0xC0,0x06,0xC0,0x40,0x0C,0x40,0xC0,0x06,0xC0,0x80,0x0B,0x40,0x80,0xC0,0x06,0xC1,0x0B,0x80,0xC1,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0x80,0xC1,0x06,0xC0,0x80,0x0B,0x40,0x81,0x06,0xC0,0x40,0x3F,0x02, // 'M'
+  0x3F,0x3F,0x3F,0x3F,0x3C,0x80,0xCA,0x80,0x08,0xC0,0x00,0x80,0xCA,0x80,0x00,0xC0,0x06,0xC0,0x80,0x40,0x0B,0x80,0xC0,0x06,0xC1,0x0B,0x80,0xC1,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0x80,0xC1,0x06,0xC0,0x80,0x0B,0x40,0x81,0x06,0xC0,0x40,0x3F,0x02, // 'N'
+  0x02,0x40,0xCC,0x80,0x08,0xC0,0x40,0x80,0xCA,0x80,0x40,0x07,0xC0,0x80,0x00,0x80,0xC8,0x80,0x00,0x81,0x06,0xC1,0x0A,0x40,0x80,0xC1,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0x80,0xC1,0x06,0xC0,0x80,0x40,0x0B,0x80,0xC0,0x06,0xC0,0x00,0x80,0xCA,0x80,0x00,0xC0,0x06,0xC0,0x00,0x80,0xCA,0x80,0x08,0xC0,0x80,0x40,0x14,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC0,0x80,0x15,0xC0,0x40,0x3F,0x02, // 'P'
+  0x3F,0x3F,0x3F,0x3F,0x3C,0x80,0xCA,0x80,0x08,0xC0,0x00,0x80,0xCA,0x80,0x08,0xC0,0x80,0x40,0x14,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC0,0x80,0x15,0xC0,0x40,0x3F,0x02, // 'R'
+  0x1A,0xC0,0x40,0x15,0xC0,0x80,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC0,0x80,0x40,0x14,0xC0,0x00,0x80,0xCA,0x80,0x08,0xC0,0x00,0x80,0xCA,0x80,0x08,0xC0,0x80,0x40,0x14,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC1,0x15,0xC0,0x80,0x00,0x80,0xC8,0x80,0x40,0x08,0xC0,0x40,0x80,0xCA,0x80,0x08,0x40,0xCC,0x80,0x1D, // 'T'
+  0x3F,0x3F,0x3F,0x3F,0x3F,0x12,0xC0,0x40,0x0C,0x40,0xC0,0x06,0xC0,0x80,0x0B,0x40,0x80,0xC0,0x06,0xC1,0x0B,0x80,0xC1,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0B,0xC2,0x06,0xC1,0x0A,0x40,0x80,0xC1,0x06,0xC0,0x80,0x00,0x80,0xC8,0x80,0x00,0x81,0x06,0xC0,0x40,0x80,0xCA,0x80,0x40,0x07,0x40,0xCC,0x80,0x1D // 'U'
+};
+const AAGlyph DSEG7_Classic_Regular_28AAGlyphs[] PROGMEM = {
+// offset, advance (0 = 없음)
+    {     0,  24 }, // '0'
+    {   145,  24 }, // '1'
+    {   208,  24 }, // '2'
+    {   301,  24 }, // '3'
+    {   394,  24 }, // '4'
+    {   490,  24 }, // '5'
+    {   583,  24 }, // '6'
+    {   704,  24 }, // '7'
+    {   808,  24 }, // '8'
+    {   957,  24 }, // '9'
+    {  1078,   7 }, // ':'
+    {     0,   0 }, // ';'
+    {     0,   0 }, // '<'
+    {     0,   0 }, // '='
+    {     0,   0 }, // '>'
+    {     0,   0 }, // '?'
+    {     0,   0 }, // '@'
+    {  1105,  24 }, // 'A'
+    {  1243,  24 }, // 'B'
+    {     0,   0 }, // 'C'
+    {     0,   0 }, // 'D'
+    {  1352,  24 }, // 'E'
+    {     0,   0 }, // 'F'
+    {  1445,  24 }, // 'G'
+    {     0,   0 }, // 'H'
+    {     0,   0 }, // 'I'
+    {     0,   0 }, // 'J'
+    {     0,   0 }, // 'K'
+    {     0,   0 }, // 'L'
+    {  1560,  24 }, // 'M'
+    {  1694,  24 }, // 'N'
+    {     0,   0 }, // 'O'
+    {  1766,  24 }, // 'P'
+    {     0,   0 }, // 'Q'
+    {  1876,  24 }, // 'R'
+    {     0,   0 }, // 'S'
+    {  1920,  24 }, // 'T'
+    {  2001,  24 } // 'U'
+};
+const AAFont DSEG7_Classic_Regular_28AA PROGMEM = {
+DSEG7_Classic_Regular_28AARuns, DSEG7_Classic_Regular_28AAGlyphs, 0x30, 0x55, 28, 29};
 
 #endif // FONTS_H
@@ -53,6 +53,6 @@ void loop() {
     // UI 업데이트
     twatch.updateUI();
     
-    // CPU 부하 감소
-    delay(20);
+    // 🆕 상태별 프레임 데드라인까지 대기 (남는 시간은 RTOS에 양보)
+    twatch.waitNextFrame();
 }
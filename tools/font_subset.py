@@ -0,0 +1,353 @@
+#!/usr/bin/env python3
+# ============================================
+# TTGO Watch Font Subset Generator
+# Version: 2.5 - Build-time Glyph Subsetting
+# ============================================
+# tools/fonts_full.h (전체 GFX 폰트 원본)에서 각 스케치가 실제로 그리는
+# 글자만 남겨 <스케치>/fonts.h를 생성
+#
+#   python3 tools/font_subset.py              # src, src/v2.5 둘 다
+#   python3 tools/font_subset.py src/v2.5     # 지정한 스케치만
+#   python3 tools/font_subset.py --check      # 생성 결과가 최신인지만 확인
+#
+# 글자 수집 규칙 (fonts.h 제외한 .ino/.cpp/.h)
+#   - &폰트이름 이 있는 줄의 문자열 리터럴
+#   - 같은 줄의 "// @glyphs <문자들>" 표시 (실행 중에 만들어지는 문자열용)
+#   - 참조되지 않은 폰트는 생성하지 않음
+#
+# GFXfont는 first..last 연속 테이블이어야 함 (TFT_eSPI가 c - first로 찾음)
+#   → 쓰는 글자의 최소..최대 범위만 남기고, 범위 안의 안 쓰는 글자는
+#     비트맵 없는 항목(width 0)으로 둠
+#   → 높이/오프셋은 원본 그대로 두어 MC_DATUM 기준선(폰트 최대 상단 높이)이 변하지 않음
+#
+# 🆕 같은 글자로 2bpp RLE 안티앨리어싱 글리프(<폰트>AA, UI-aafont.h 형식)도 생성
+#   - 칸 = xAdvance x (ascent + descent), 배경까지 포함한 칸 전체를 인코딩 (스스로 지움)
+#   - 원본이 1bpp뿐이라 scale2x 두 번(4배 확대)으로 대각선 가장자리를 복원한 뒤
+#     4x4 박스 평균 → 커버리지 0..3
+#   - run 바이트 = (레벨 << 6) | (길이 - 1), 행 끝을 넘어 이어질 수 있음
+
+import argparse
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+SOURCE = os.path.join(ROOT, 'tools', 'fonts_full.h')
+SKETCHES = ['src', os.path.join('src', 'v2.5')]
+
+FONT_RE = re.compile(
+    r'const uint8_t (\w+)Bitmaps\[\] PROGMEM = \{(.*?)\};\s*'
+    r'const GFXglyph \1Glyphs\[\] PROGMEM = \{(.*?)\};\s*'
+    r'const GFXfont \1 PROGMEM = \{\s*\(uint8_t\s*\*\)\1Bitmaps,\s*\(GFXglyph\s*\*\)\1Glyphs,\s*'
+    r'(0x[0-9A-Fa-f]+),\s*(0x[0-9A-Fa-f]+),\s*(\d+)\s*\};', re.S)
+GLYPH_RE = re.compile(r'\{\s*(\d+),\s*(\d+),\s*(\d+),\s*(\d+),\s*(-?\d+),\s*(-?\d+)\s*\}')
+STRING_RE = re.compile(r'"((?:[^"\\]|\\.)*)"')
+MARK_RE = re.compile(r'//\s*@glyphs\s+(\S+)')
+
+
+# ============================================
+# 원본 폰트 읽기
+# ============================================
+def load_fonts(path):
+    text = open(path, encoding='utf-8').read()
+    fonts = {}
+    for m in FONT_RE.finditer(text):
+        name, bitmap_src, glyph_src = m.group(1), m.group(2), m.group(3)
+        bitmap = [int(b, 16) for b in re.findall(r'0x[0-9A-Fa-f]{2}', bitmap_src)]
+        glyphs = [tuple(int(v) for v in g) for g in GLYPH_RE.findall(glyph_src)]
+        first, last = int(m.group(4), 16), int(m.group(5), 16)
+        # 원본 테이블의 마지막 글자가 last보다 짧은 경우가 있음 (0x7E 선언, '}'까지만 존재)
+        last = min(last, first + len(glyphs) - 1)
+        fonts[name] = {
+            'bitmap': bitmap,
+            'glyphs': glyphs,
+            'first': first,
+            'last': last,
+            'yAdvance': int(m.group(6)),
+        }
+    if not fonts:
+        sys.exit('font_subset: no GFX fonts found in ' + path)
+    return fonts
+
+
+# ============================================
+# 스케치에서 쓰는 글자 수집
+# ============================================
+def unescape(s):
+    return bytes(s, 'utf-8').decode('unicode_escape')
+
+
+def scan_sketch(sketch, names):
+    used = {}
+    for fn in sorted(os.listdir(sketch)):
+        if fn == 'fonts.h' or not fn.endswith(('.ino', '.cpp', '.h')):
+            continue
+        for line in open(os.path.join(sketch, fn), encoding='utf-8'):
+            for name in names:
+                if not re.search(r'&' + name + r'\b', line):
+                    continue
+                chars = used.setdefault(name, set())
+                code = line.split('//')[0]
+                for s in STRING_RE.findall(code):
+                    chars.update(unescape(s))
+                mark = MARK_RE.search(line)
+                if mark:
+                    chars.update(mark.group(1))
+    return used
+
+
+# ============================================
+# 서브셋 생성
+# ============================================
+def metrics(glyphs):
+    ascent = max(-g[5] for g in glyphs)
+    descent = max(g[2] + g[5] for g in glyphs)
+    return ascent, descent
+
+
+def subset(font, chars):
+    first, last = font['first'], font['last']
+    codes = sorted(ord(c) for c in chars if first <= ord(c) <= last)
+    if not codes:
+        return None
+    lo, hi = codes[0], codes[-1]
+    full = font['glyphs']
+
+    bitmap = []
+    entries = []
+    for c in range(lo, hi + 1):
+        off, w, h, adv, xo, yo = full[c - first]
+        if c in codes:
+            size = (w * h + 7) // 8
+            rows = font['bitmap'][off:off + size]
+            entries.append(((len(bitmap), w, h, adv, xo, yo), c, rows, ''))
+            bitmap.extend(rows)
+        else:
+            entries.append(((0, 0, h, adv, xo, yo), c, None, ''))
+
+    # 잘려 나간 글자가 최대 상단/하단 높이를 갖고 있었으면 범위 안의 미사용 항목에 옮김
+    # (TFT_eSPI glyph_ab/glyph_bb, SegmentReadout 기준선이 원본과 같도록)
+    # 미사용 항목이 없으면 그 글자까지 범위를 넓혀 다시 계산
+    want = metrics(full)
+    if metrics([e[0] for e in entries]) != want:
+        spare = [i for i, e in enumerate(entries) if e[2] is None]
+        if not spare:
+            k = 0 if metrics([e[0] for e in entries])[0] < want[0] else 1
+            c = min((c for c in range(first, last + 1) if metrics([full[c - first]])[k] == want[k]),
+                    key=lambda c: min(abs(c - lo), abs(c - hi)))
+            return subset(font, set(chars) | {chr(c)})
+        g, c, rows, _ = entries[spare[0]]
+        entries[spare[0]] = ((0, 0, want[0] + want[1], g[3], g[4], -want[0]), c, None, ', 기준선 유지')
+
+    return {'first': lo, 'last': hi, 'entries': entries, 'bytes': len(bitmap)}
+
+
+# ============================================
+# 🆕 2bpp RLE 안티앨리어싱 글리프
+# ============================================
+AA_SCALE_PASSES = 2          # scale2x 횟수 (2 → 4배)
+AA_RUN_MAX = 64
+
+
+def glyph_cell(font, c, ascent, height):
+    # 1bpp 글리프를 칸 좌표 (기준선 = ascent 행)로 펼침
+    off, w, h, adv, xo, yo = font['glyphs'][c - font['first']]
+    cell = [[0] * adv for _ in range(height)]
+    clipped = 0
+    for gy in range(h):
+        for gx in range(w):
+            bit = gy * w + gx
+            if not font['bitmap'][off + (bit >> 3)] & (0x80 >> (bit & 7)):
+                continue
+            x, y = xo + gx, ascent + yo + gy
+            if 0 <= x < adv and 0 <= y < height:
+                cell[y][x] = 1
+            else:
+                clipped += 1
+    return cell, clipped
+
+
+def scale2x(img):
+    h, w = len(img), len(img[0])
+    px = lambda x, y: img[y][x] if 0 <= x < w and 0 <= y < h else 0
+    out = [[0] * (w * 2) for _ in range(h * 2)]
+    for y in range(h):
+        for x in range(w):
+            p = img[y][x]
+            a, b, c, d = px(x, y - 1), px(x + 1, y), px(x - 1, y), px(x, y + 1)
+            out[2 * y][2 * x] = a if c == a and c != d and a != b else p
+            out[2 * y][2 * x + 1] = b if a == b and a != c and b != d else p
+            out[2 * y + 1][2 * x] = c if d == c and d != b and c != a else p
+            out[2 * y + 1][2 * x + 1] = d if b == d and b != a and d != c else p
+    return out
+
+
+def coverage(cell):
+    if not cell or not cell[0]:
+        return []
+    big = cell
+    for _ in range(AA_SCALE_PASSES):
+        big = scale2x(big)
+    n = 1 << AA_SCALE_PASSES
+    levels = []
+    for y in range(len(cell)):
+        for x in range(len(cell[0])):
+            on = sum(big[y * n + j][x * n + i] for j in range(n) for i in range(n))
+            levels.append((on * 3 + (n * n) // 2) // (n * n))
+    return levels
+
+
+def encode_runs(levels):
+    runs = []
+    i = 0
+    while i < len(levels):
+        level = levels[i]
+        n = 1
+        while i + n < len(levels) and levels[i + n] == level and n < AA_RUN_MAX:
+            n += 1
+        runs.append((level << 6) | (n - 1))
+        i += n
+    return runs
+
+
+def decode_runs(runs, count):
+    levels = []
+    for r in runs:
+        levels.extend([r >> 6] * ((r & 0x3F) + 1))
+    return levels[:count]
+
+
+def smooth_subset(font, sub):
+    ascent, descent = metrics(font['glyphs'])
+    height = ascent + descent
+    runs = []
+    glyphs = []
+    for g, c, rows, _ in sub['entries']:
+        if rows is None:
+            glyphs.append((0, 0, c))
+            continue
+        cell, clipped = glyph_cell(font, c, ascent, height)
+        if clipped:
+            print('font_subset: %r clipped %d px outside its cell' % (chr(c), clipped), file=sys.stderr)
+        levels = coverage(cell)
+        enc = encode_runs(levels)
+        assert decode_runs(enc, len(levels)) == levels
+        glyphs.append((len(runs), g[3], c, enc))
+        runs.extend(enc)
+    return {'ascent': ascent, 'height': height, 'runs': runs, 'glyphs': glyphs}
+
+
+def char_comment(c):
+    return "'%s'" % chr(c)
+
+
+def emit(fonts, used, sketch):
+    out = []
+    out.append('// ============================================')
+    out.append('// TTGO Watch Fonts (생성 파일 - 직접 수정하지 말 것)')
+    out.append('// tools/font_subset.py가 tools/fonts_full.h에서 쓰는 글자만 추출')
+    out.append('// ============================================')
+    out.append('#ifndef FONTS_H')
+    out.append('#define FONTS_H')
+    out.append('')
+    out.append('#include "UI-aafont.h"')
+    out.append('')
+
+    total = 0
+    for name in fonts:
+        if name not in used:
+            continue
+        font = fonts[name]
+        sub = subset(font, used[name])
+        if sub is None:
+            continue
+        full_bytes = len(font['bitmap']) + len(font['glyphs']) * 7
+        sub_bytes = sub['bytes'] + len(sub['entries']) * 7
+        total += sub_bytes
+        drawn = ''.join(chr(c) for _, c, rows, _ in sub['entries'] if rows is not None)
+
+        out.append('// %s: "%s" (%d/%d glyphs, %d bytes, 원본 %d bytes)' % (
+            name, drawn, len(drawn), len(font['glyphs']), sub_bytes, full_bytes))
+        out.append('const uint8_t %sBitmaps[] PROGMEM = {' % name)
+        lines = []
+        for _, c, rows, _ in sub['entries']:
+            if rows:
+                lines.append(('  ' + ','.join('0x%02X' % b for b in rows), c))
+        for i, (line, c) in enumerate(lines):
+            sep = ',' if i < len(lines) - 1 else ''
+            out.append('%s%s // %s' % (line, sep, char_comment(c)))
+        out.append('};')
+
+        out.append('const GFXglyph %sGlyphs[] PROGMEM = {' % name)
+        out.append('// bitmapOffset, width, height, xAdvance, xOffset, yOffset')
+        for i, (g, c, rows, extra) in enumerate(sub['entries']):
+            sep = ',' if i < len(sub['entries']) - 1 else ''
+            note = '' if rows is not None else ' (미사용%s)' % extra
+            out.append('    { %5d, %3d, %3d, %3d, %4d, %4d }%s // %s%s' % (g + (sep, char_comment(c), note)))
+        out.append('};')
+
+        out.append('const GFXfont %s PROGMEM = {' % name)
+        out.append('(uint8_t  *)%sBitmaps,(GFXglyph *)%sGlyphs,0x%02X, 0x%02X, %d};' % (
+            name, name, sub['first'], sub['last'], font['yAdvance']))
+        out.append('')
+
+        aa = smooth_subset(font, sub)
+        aa_bytes = len(aa['runs']) + len(aa['glyphs']) * 4
+        total += aa_bytes
+        out.append('// %sAA: 2bpp RLE, %d행 칸 (%d bytes)' % (name, aa['height'], aa_bytes))
+        out.append('const uint8_t %sAARuns[] PROGMEM = {' % name)
+        drawn = [g for g in aa['glyphs'] if len(g) == 4]
+        for i, (_, _, c, enc) in enumerate(drawn):
+            sep = ',' if i < len(drawn) - 1 else ''
+            out.append('  %s%s // %s' % (','.join('0x%02X' % b for b in enc), sep, char_comment(c)))
+        out.append('};')
+        out.append('const AAGlyph %sAAGlyphs[] PROGMEM = {' % name)
+        out.append('// offset, advance (0 = 없음)')
+        for i, g in enumerate(aa['glyphs']):
+            sep = ',' if i < len(aa['glyphs']) - 1 else ''
+            out.append('    { %5d, %3d }%s // %s' % (g[0], g[1], sep, char_comment(g[2])))
+        out.append('};')
+        out.append('const AAFont %sAA PROGMEM = {' % name)
+        out.append('%sAARuns, %sAAGlyphs, 0x%02X, 0x%02X, %d, %d};' % (
+            name, name, sub['first'], sub['last'], aa['ascent'], aa['height']))
+        out.append('')
+
+    out.append('#endif // FONTS_H')
+    return '\n'.join(out) + '\n', total
+
+
+# ============================================
+# Main
+# ============================================
+def main():
+    parser = argparse.ArgumentParser(description='Generate per-sketch GFX font subsets.')
+    parser.add_argument('sketches', nargs='*', default=SKETCHES)
+    parser.add_argument('--check', action='store_true', help='fail if a fonts.h is out of date')
+    args = parser.parse_args()
+
+    fonts = load_fonts(SOURCE)
+    full = sum(len(f['bitmap']) + len(f['glyphs']) * 7 for f in fonts.values())
+    stale = False
+
+    for sketch in args.sketches:
+        path = os.path.join(ROOT, sketch) if not os.path.isabs(sketch) else sketch
+        used = scan_sketch(path, list(fonts))
+        text, total = emit(fonts, used, path)
+        target = os.path.join(path, 'fonts.h')
+
+        old = open(target, encoding='utf-8').read() if os.path.exists(target) else None
+        if args.check:
+            if old != text:
+                print('%s: out of date' % target)
+                stale = True
+            continue
+        if old != text:
+            open(target, 'w', encoding='utf-8').write(text)
+        print('%s: %s, %d bytes (full set %d bytes)' % (
+            os.path.relpath(target, ROOT), ', '.join(sorted(used)) or 'no fonts', total, full))
+
+    return 1 if stale else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,173 @@
+#!/usr/bin/env python3
+# ============================================
+# TTGO Watch Glyph Store Generator
+# Version: 2.5 - LittleFS Glyph Streaming
+# ============================================
+# BDF 비트맵 폰트(한글 포함)에서 UI-glyphstore.h 형식의 글리프 저장소 파일 생성
+# → 스케치의 data/ 폴더에 넣고 LittleFS로 업로드, config.h의 USE_HANGUL_TEXT 켜기
+#
+#   python3 tools/glyph_store.py font.bdf src/v2.5/data/hangul.bin
+#       ASCII 0x20..0x7E + 한글 음절 11,172자 + 호환 자모 (폰트에 있는 글자만)
+#   python3 tools/glyph_store.py font.bdf src/v2.5/data/hangul.bin --sketch src/v2.5
+#       ASCII + 스케치 문자열 리터럴에 나오는 ASCII 밖 글자만 (작은 파일)
+#
+# 파일 형식 (little-endian)
+#   [헤더 16B] "GST1", 개수(u16), 칸 높이(u8), ascent(u8), 색인 위치(u32), 비트맵 위치(u32)
+#   [색인 8B x 개수] 코드포인트(u16), 칸 폭(u8), 예약(u8), 비트맵 오프셋(u32) - 오름차순
+#   [비트맵] 칸 폭 x 높이 1bpp, 행마다 바이트 정렬, MSB = 왼쪽
+#
+# 칸 = DWIDTH x (FONT_ASCENT + FONT_DESCENT), 기준선 = 위에서 ascent
+#   → 글자마다 BBX 오프셋을 칸 안에 미리 배치 (그릴 때는 칸 전체를 그대로 씀)
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+MAX_BYTES = 72      # config.h GLYPH_STORE_MAX_BYTES와 같게
+STRING_RE = re.compile(r'"((?:[^"\\]|\\.)*)"')
+
+ASCII = range(0x20, 0x7F)
+HANGUL_SYLLABLES = range(0xAC00, 0xD7A4)
+HANGUL_JAMO = range(0x3131, 0x318F)
+
+
+# ============================================
+# BDF 읽기
+# ============================================
+def load_bdf(path):
+    glyphs = {}
+    ascent = descent = None
+    cur = None
+    bitmap = None
+
+    for line in open(path, encoding='latin-1'):
+        parts = line.split()
+        if not parts:
+            continue
+        key = parts[0]
+
+        if bitmap is not None:
+            if key == 'ENDCHAR':
+                cur['rows'] = bitmap
+                if cur.get('cp') is not None and cur['cp'] >= 0:
+                    glyphs[cur['cp']] = cur
+                cur = bitmap = None
+            else:
+                bitmap.append(int(key, 16))
+            continue
+
+        if key == 'FONT_ASCENT':
+            ascent = int(parts[1])
+        elif key == 'FONT_DESCENT':
+            descent = int(parts[1])
+        elif key == 'STARTCHAR':
+            cur = {}
+        elif key == 'ENCODING' and cur is not None:
+            cur['cp'] = int(parts[1])
+        elif key == 'DWIDTH' and cur is not None:
+            cur['advance'] = int(parts[1])
+        elif key == 'BBX' and cur is not None:
+            cur['bbx'] = tuple(int(v) for v in parts[1:5])
+        elif key == 'BITMAP' and cur is not None:
+            bitmap = []
+
+    if ascent is None or descent is None:
+        sys.exit('%s: FONT_ASCENT / FONT_DESCENT 없음' % path)
+    return glyphs, ascent, descent
+
+
+# 칸(advance x height)에 글리프를 배치한 1bpp 행 바이트
+def render_cell(g, ascent, height):
+    adv = g.get('advance', 0)
+    w, h, xoff, yoff = g['bbx']
+    stride = (adv + 7) // 8
+    row_bits = ((w + 7) // 8) * 8
+    cell = bytearray(stride * height)
+
+    top = ascent - (yoff + h)
+    for j, value in enumerate(g['rows'][:h]):
+        y = top + j
+        if y < 0 or y >= height:
+            continue
+        for i in range(w):
+            if not (value >> (row_bits - 1 - i)) & 1:
+                continue
+            x = xoff + i
+            if 0 <= x < adv:
+                cell[y * stride + x // 8] |= 0x80 >> (x % 8)
+    return bytes(cell)
+
+
+# ============================================
+# 글자 모으기
+# ============================================
+def sketch_chars(sketch):
+    chars = set()
+    for name in sorted(os.listdir(sketch)):
+        if not name.endswith(('.ino', '.cpp', '.h')) or name == 'fonts.h':
+            continue
+        text = open(os.path.join(sketch, name), encoding='utf-8').read()
+        for s in STRING_RE.findall(text):
+            chars.update(ord(c) for c in s if 0x80 <= ord(c) <= 0xFFFF)
+    return chars
+
+
+def build(glyphs, ascent, descent, codepoints):
+    height = ascent + descent
+    entries = []
+    bitmaps = bytearray()
+    skipped = []
+
+    for cp in sorted(codepoints):
+        g = glyphs.get(cp)
+        if g is None or 'bbx' not in g or g.get('advance', 0) <= 0 or g['advance'] > 255:
+            continue
+        cell = render_cell(g, ascent, height)
+        if len(cell) > MAX_BYTES:
+            skipped.append(cp)
+            continue
+        entries.append(struct.pack('<HBBI', cp, g['advance'], 0, len(bitmaps)))
+        bitmaps += cell
+
+    if skipped:
+        print('  %d자는 %dB 슬롯보다 커서 제외 (예: U+%04X)' % (len(skipped), MAX_BYTES, skipped[0]))
+
+    index_offset = 16
+    bitmap_offset = index_offset + 8 * len(entries)
+    header = b'GST1' + struct.pack('<HBBII', len(entries), height, ascent, index_offset, bitmap_offset)
+    return header + b''.join(entries) + bytes(bitmaps), len(entries)
+
+
+def main():
+    ap = argparse.ArgumentParser(description='BDF → LittleFS 글리프 저장소')
+    ap.add_argument('bdf', help='BDF 폰트 (예: 16px 한글 비트맵 폰트)')
+    ap.add_argument('out', help='출력 파일 (예: src/v2.5/data/hangul.bin)')
+    ap.add_argument('--sketch', help='이 스케치의 문자열에 나오는 글자만 (기본: 한글 전체)')
+    args = ap.parse_args()
+
+    glyphs, ascent, descent = load_bdf(args.bdf)
+    if ascent + descent > 255:
+        sys.exit('칸 높이가 너무 큼: %d' % (ascent + descent))
+
+    codepoints = set(ASCII)
+    if args.sketch:
+        codepoints |= sketch_chars(os.path.join(ROOT, args.sketch))
+    else:
+        codepoints |= set(HANGUL_SYLLABLES) | set(HANGUL_JAMO)
+
+    data, count = build(glyphs, ascent, descent, codepoints)
+    missing = sorted(cp for cp in codepoints if cp not in glyphs)
+    if args.sketch and missing:
+        print('  폰트에 없는 글자: %s' % ''.join(chr(cp) for cp in missing if cp >= 0x80))
+
+    os.makedirs(os.path.dirname(os.path.abspath(args.out)), exist_ok=True)
+    with open(args.out, 'wb') as f:
+        f.write(data)
+    print('%s: %d glyphs, %dpx cells, %d bytes' % (args.out, count, ascent + descent, len(data)))
+
+
+if __name__ == '__main__':
+    main()